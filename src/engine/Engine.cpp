@@ -1,6 +1,7 @@
 #include "Engine.hpp"
-#include <iostream>
+#include "core/profiling/TraceProfiler.hpp"
 #include <algorithm>
+#include <cmath>
 #include "core/ecs/systems/CollisionSystem.hpp"
 #include "core/ecs/systems/PhysicsSystem.hpp"
 #include "core/ecs/systems/LifetimeSystem.hpp"
@@ -9,6 +10,7 @@
 #include "core/ecs/systems/ParticleSystem.hpp"
 #include "core/ecs/systems/AnimationSystem.hpp"
 #include "core/ecs/systems/SpriteStateSystem.hpp"
+#include "engine/core/log/Logger.hpp"
 
 namespace engine {
 
@@ -22,50 +24,93 @@ Engine::~Engine() {
 
 bool Engine::Initialize(const EngineConfig& config) {
     if (initialized_) {
-        std::cerr << "[Engine] Already initialized!" << std::endl;
+        LOG_ERROR("Engine") << "Already initialized!";
         return false;
     }
     
     config_ = config;
+    log::Logger::SetLevel(config_.logLevel);
+    if (config_.fixedTimestep && config_.fixedTickRate <= 0) {
+        LOG_WARN("Engine") << "Invalid fixedTickRate " << config_.fixedTickRate
+                           << ", falling back to a variable timestep";
+        config_.fixedTimestep = false;
+    }
+    
+    jobSystem_.SetWorkerCount(config_.workerThreads < 0
+        ? job::JobSystem::AUTO_DETECT
+        : static_cast<size_t>(config_.workerThreads));
     
     // Initialize renderer first
-    if (!renderer_.Init(config_.windowTitle, config_.windowWidth, config_.windowHeight)) {
-        std::cerr << "[Engine] Failed to initialize renderer" << std::endl;
+    bool rendererReady = config_.headless
+        ? renderer_.InitHeadless()
+        : renderer_.Init(config_.windowTitle, config_.windowWidth, config_.windowHeight);
+    if (!rendererReady) {
+        LOG_ERROR("Engine") << "Failed to initialize renderer";
         return false;
     }
     
-    // Initialize sprite renderer
+    // Initialize sprite renderer (both accept a null SDL_Renderer when headless)
     spriteRenderer_ = std::make_unique<graphics::SpriteRenderer>(renderer_.GetSDLRenderer());
     resourceManager_ = std::make_unique<resources::ResourceManager>(renderer_.GetSDLRenderer());
+    if (config_.textureAtlas) {
+        resourceManager_->EnableAtlas(config_.textureAtlasPageSize);
+    }
     
     // Initialize and connect systems
     InitializeSystems();
     
+    profiling::TraceProfiler::SetThreadName("Main");
+    if (config_.traceOnStartup) {
+        profiling::TraceProfiler::BeginCapture();
+    }
+    
     initialized_ = true;
-    lastFrameTime_ = SDL_GetTicks();
+    framePacer_.SetTargetRate(config_.targetFPS);
+    framePacer_.SetSpinThreshold(static_cast<uint64_t>(std::max(config_.frameSpinMicroseconds, 0)) * 1000);
+    framePacer_.Reset();
     
-    std::cout << "[Engine] Successfully initialized" << std::endl;
+    LOG_INFO("Engine") << "Successfully initialized";
     return true;
 }
 
 void Engine::Run() {
     if (!initialized_) {
-        std::cerr << "[Engine] Not initialized! Call Initialize() first." << std::endl;
+        LOG_ERROR("Engine") << "Not initialized! Call Initialize() first.";
         return;
     }
     
     isRunning_ = true;
-    std::cout << "[Engine] Starting main loop" << std::endl;
+    frameCount_ = 0;
+    accumulator_ = 0.0;
+    LOG_INFO("Engine") << "Starting main loop" << (config_.headless ? " (headless)" : "");
+    Uint64 loopStart = SDL_GetTicks();
+    // Setup between Initialize() and Run() isn't a frame
+    framePacer_.Reset();
+    framePacer_.ResetStats();
     
     while (isRunning_) {
         UpdateTiming();
+        PROFILE_SCOPE("Frame");
         HandleEvents();
         UpdateSystems();
         // Render
-        sceneManager_.Render(renderer_.GetSDLRenderer());
+        if (!config_.headless) {
+            PROFILE_SCOPE("SceneManager::Render");
+            sceneManager_.Render(renderer_.GetSDLRenderer());
+        }
+        
+        if (++frameCount_ == config_.maxFrames) {
+            RequestExit();
+        }
     }
     
-    std::cout << "[Engine] Main loop ended" << std::endl;
+    Uint64 elapsedMs = SDL_GetTicks() - loopStart;
+    LOG_INFO("Engine") << "Main loop ended after " << frameCount_ << " frames in " << elapsedMs << " ms"
+                       << " (avg " << (elapsedMs > 0 ? frameCount_ * 1000.0 / elapsedMs : 0.0) << " FPS)";
+    auto pacing = framePacer_.GetStats();
+    LOG_INFO("Engine") << "Frame time " << pacing.meanMs << " ms mean, " << std::sqrt(pacing.varianceMs2)
+                       << " ms stddev, " << pacing.minMs << "-" << pacing.maxMs << " ms, "
+                       << pacing.missedDeadlines << " missed deadline(s)";
 }
 
 void Engine::Shutdown() {
@@ -73,19 +118,25 @@ void Engine::Shutdown() {
         return;
     }
     
-    std::cout << "[Engine] Shutting down..." << std::endl;
+    LOG_INFO("Engine") << "Shutting down...";
     
     isRunning_ = false;
     
+    if (profiling::TraceProfiler::IsCapturing()) {
+        profiling::TraceProfiler::EndCapture(config_.traceOutputPath);
+    }
+    
     world_->GetSystemManager().ClearAllSystems();
     world_->ClearAllEntities();
     
     spriteRenderer_.reset();
     resourceManager_.reset();
     renderer_.Shutdown();
+    jobSystem_.SetWorkerCount(0);
     
     initialized_ = false;
-    std::cout << "[Engine] Shutdown complete" << std::endl;
+    LOG_INFO("Engine") << "Shutdown complete";
+    log::Logger::Flush();
 }
 
 void Engine::InitializeSystems() {
@@ -93,7 +144,7 @@ void Engine::InitializeSystems() {
     inputManager_.SetEventManager(&eventManager_);
     sceneManager_.SetEventManager(&eventManager_);
     sceneManager_.SetInputManager(&inputManager_);
-    world_ = std::make_unique<engine::ECS::World>(&eventManager_);
+    world_ = std::make_unique<engine::ECS::World>(&eventManager_, &jobSystem_);
     sceneManager_.SetWorld(world_.get());
     
     // **Add core ECS systems**
@@ -133,16 +184,60 @@ void Engine::InitializeSystems() {
     auto debugRenderSystem = std::make_unique<ECS::DebugRenderSystem>(renderer_.GetSDLRenderer(), &inputManager_);
     systemManager.AddSystem(std::move(debugRenderSystem), 100);
     
-    std::cout << "[Engine] Core ECS systems initialized (including RenderSystem and DebugRenderSystem)" << std::endl;
+    LOG_INFO("Engine") << "Core ECS systems initialized (including RenderSystem and DebugRenderSystem)";
 }
 
 void Engine::UpdateSystems() {
+    PROFILE_SCOPE("Engine::UpdateSystems");
     // Don't clear input states before systems process them!
     // inputManager_.Update(); // Move this to end of frame
     eventManager_.Update();
-    world_->Update(deltaTime_);
+    if (!config_.fixedTimestep) {
+        world_->Update(deltaTime_);
+        sceneManager_.Update(deltaTime_);
+        inputManager_.Update(); // Clear input states after systems have processed them
+        return;
+    }
+    
+    RunFixedSteps();
+    world_->UpdatePhase(ECS::SystemPhase::Render, deltaTime_);
     sceneManager_.Update(deltaTime_);
-    inputManager_.Update(); // Clear input states after systems have processed them
+}
+
+void Engine::RunFixedSteps() {
+    // Computed in float so a headless frame of 1 / tickRate is exactly one tick
+    const double step = 1.0f / config_.fixedTickRate;
+    const int maxSteps = std::max(config_.maxFixedStepsPerFrame, 1);
+    auto* renderSystem = static_cast<ECS::RenderSystem*>(world_->GetSystemManager().GetSystem("RenderSystem"));
+    
+    accumulator_ += deltaTime_;
+    int steps = 0;
+    while (accumulator_ >= step && steps < maxSteps) {
+        if (renderSystem) {
+            renderSystem->CapturePreviousTransforms();
+        }
+        world_->UpdatePhase(ECS::SystemPhase::Fixed, static_cast<float>(step));
+        accumulator_ -= step;
+        ++steps;
+        ++tickCount_;
+        
+        // Key/button-down flags count once, not once per tick. Frames without
+        // a tick keep them for the next one.
+        if (steps == 1) {
+            inputManager_.Update();
+        }
+    }
+    
+    if (accumulator_ >= step) {
+        LOG_WARN_EVERY("Engine", 1000) << "Simulation falling behind, dropped "
+                                       << static_cast<int>(accumulator_ / step) << " tick(s)";
+        accumulator_ = std::fmod(accumulator_, step);
+    }
+    
+    interpolationAlpha_ = static_cast<float>(accumulator_ / step);
+    if (renderSystem) {
+        renderSystem->SetInterpolationAlpha(interpolationAlpha_);
+    }
 }
 
 void Engine::HandleEvents() {
@@ -154,7 +249,11 @@ void Engine::HandleEvents() {
         
         // DEBUG: Log R key events at the engine level
         if (event.type == SDL_EVENT_KEY_DOWN && event.key.key == SDLK_R) {
-            std::cout << "[Engine] R key event received from SDL!" << std::endl;
+            LOG_DEBUG("Engine") << "R key event received from SDL!";
+        }
+        
+        if (event.type == SDL_EVENT_KEY_DOWN && event.key.key == SDLK_F9 && !event.key.repeat) {
+            ToggleTraceCapture();
         }
         
         inputManager_.HandleEvent(event);
@@ -162,23 +261,24 @@ void Engine::HandleEvents() {
     }
 }
 
+void Engine::ToggleTraceCapture() {
+    if (profiling::TraceProfiler::IsCapturing()) {
+        profiling::TraceProfiler::EndCapture(config_.traceOutputPath);
+    } else {
+        profiling::TraceProfiler::BeginCapture();
+    }
+}
+
 void Engine::UpdateTiming() {
-    Uint64 currentTime = SDL_GetTicks();
-    deltaTime_ = (currentTime - lastFrameTime_) / 1000.0f;
-    lastFrameTime_ = currentTime;
+    deltaTime_ = framePacer_.WaitForNextFrame();
     
     // Calculate FPS
     if (deltaTime_ > 0.0f) {
         fps_ = 1.0f / deltaTime_;
     }
     
-    // Cap frame rate if needed
-    if (config_.targetFPS > 0) {
-        float targetFrameTime = 1.0f / config_.targetFPS;
-        if (deltaTime_ < targetFrameTime) {
-            Uint32 delayTime = static_cast<Uint32>((targetFrameTime - deltaTime_) * 1000.0f);
-            SDL_Delay(delayTime);
-        }
+    if (config_.headless && config_.headlessDeltaTime > 0.0f) {
+        deltaTime_ = config_.headlessDeltaTime;
     }
 }
 
@@ -2,6 +2,9 @@
 
 #include "core/ecs/World.hpp"
 #include "core/event/EventManager.hpp"
+#include "core/job/JobSystem.hpp"
+#include "core/log/Logger.hpp"
+#include "core/time/FramePacer.hpp"
 #include "input/InputManager.hpp"
 #include "core/scene/SceneManager.hpp"
 #include "graphics/renderer/Renderer.hpp"
@@ -23,7 +26,39 @@ struct EngineConfig {
     int windowHeight = 600;
     bool fullscreen = false;
     bool vsync = true;
+    // Frame cap (any rate, e.g. 144 or 240); 0 = uncapped. The pacer sleeps
+    // until frameSpinMicroseconds before each deadline, then yields.
     int targetFPS = 60;
+    int frameSpinMicroseconds = 1000;
+    // Fixed-phase systems step in ticks of 1 / fixedTickRate seconds, zero or
+    // more per frame; Render-phase systems run once per frame and interpolate
+    // between the last two ticks. false = one variable-dt update per frame.
+    bool fixedTimestep = true;
+    int fixedTickRate = 60;
+    // Ticks allowed per frame; past this the backlog is dropped so a slow
+    // frame can't snowball into ever more ticks (spiral of death)
+    int maxFixedStepsPerFrame = 5;
+    // Job system worker threads: -1 = one per core (minus the main thread),
+    // 0 = single-threaded, deterministic execution
+    int workerThreads = -1;
+    // Pack loaded images into shared atlas pages of textureAtlasPageSize
+    // pixels square, so sprites from different sheets batch into one draw
+    bool textureAtlas = false;
+    int textureAtlasPageSize = 2048;
+    // Chrome trace capture (PROFILE_SCOPE markers): F9 starts/stops a capture,
+    // and a capture still running at shutdown is written too
+    std::string traceOutputPath = "trace.json";
+    bool traceOnStartup = false;
+    // Runtime log threshold; ENGINE_LOG_MIN_LEVEL strips lower levels at compile time
+    log::Level logLevel = log::Level::Info;
+    // No window or GPU: systems, events and scenes still run but nothing is
+    // drawn. Set targetFPS = 0 to run as fast as the CPU allows.
+    bool headless = false;
+    // Simulated seconds per headless frame, independent of wall-clock time so
+    // uncapped runs stay deterministic (0 = measured frame time)
+    float headlessDeltaTime = 1.0f / 60.0f;
+    // Stop after this many frames (0 = run until RequestExit())
+    uint64_t maxFrames = 0;
 };
 
 /**
@@ -65,6 +100,7 @@ public:
     // System access
     ECS::World& GetWorld() { return *world_; }
     event::EventManager& GetEventManager() { return eventManager_; }
+    job::JobSystem& GetJobSystem() { return jobSystem_; }
     input::InputManager& GetInputManager() { return inputManager_; }
     scene::SceneManager& GetSceneManager() { return sceneManager_; }
     graphics::Renderer& GetRenderer() { return renderer_; }
@@ -76,6 +112,14 @@ public:
     bool IsRunning() const { return isRunning_; }
     float GetDeltaTime() const { return deltaTime_; }
     float GetFPS() const { return fps_; }
+    uint64_t GetFrameCount() const { return frameCount_; }
+    uint64_t GetTickCount() const { return tickCount_; }
+    float GetFixedDeltaTime() const { return 1.0f / config_.fixedTickRate; }
+    // Progress from the last tick towards the next one, in [0, 1)
+    float GetInterpolationAlpha() const { return interpolationAlpha_; }
+    time::FramePacingStats GetFramePacingStats() const { return framePacer_.GetStats(); }
+    void ResetFramePacingStats() { framePacer_.ResetStats(); }
+    bool IsHeadless() const { return config_.headless; }
     
     // Scene management shortcuts
     template<typename SceneType, typename... Args>
@@ -91,6 +135,7 @@ public:
 
 private:
     // Core systems
+    job::JobSystem jobSystem_;
     event::EventManager eventManager_;
     input::InputManager inputManager_;
     scene::SceneManager sceneManager_;
@@ -105,15 +150,21 @@ private:
     EngineConfig config_;
     
     // Timing
-    Uint64 lastFrameTime_ = 0;
+    time::FramePacer framePacer_;
     float deltaTime_ = 0.0f;
     float fps_ = 0.0f;
+    uint64_t frameCount_ = 0;
+    uint64_t tickCount_ = 0;
+    double accumulator_ = 0.0;
+    float interpolationAlpha_ = 1.0f;
     
     // Internal methods
     void InitializeSystems();
     void UpdateSystems();
+    void RunFixedSteps();
     void HandleEvents();
     void UpdateTiming();
+    void ToggleTraceCapture();
 };
 
 } // namespace engine
@@ -1,8 +1,9 @@
 // src/engine/animation/SpriteSheetLoader.cpp
 
 #include "SpriteSheetLoader.hpp"
+#include <algorithm>
+#include "engine/core/log/Logger.hpp"
 #include <SDL3/SDL.h>
-#include <iostream>
 #include <cmath>
 #include <vector>
 
@@ -35,17 +36,17 @@ engine::ECS::SpriteAnimation SpriteSheetLoader::CreateAnimation(const std::strin
     SpriteSheetInfo info = AnalyzeSpriteSheet(texturePath, expectedFrameCount);
     
     if (!info.isValid) {
-        std::cout << "[SpriteSheetLoader] Warning: Could not analyze " << texturePath 
-                  << ", using defaults" << std::endl;
+        LOG_WARN("SpriteSheetLoader") << "Could not analyze " << texturePath 
+                                      << ", using defaults";
         return engine::ECS::SpriteAnimation{
             1, 1, 32, 32, frameDuration, loop, true
         };
     }
     
-    std::cout << "*** [SpriteSheetLoader] " << texturePath << ": " 
-              << info.frameCount << " frames, " 
-              << info.frameWidth << "x" << info.frameHeight << " each (total: " 
-              << info.totalWidth << "x" << info.totalHeight << ") ***" << std::endl;
+    LOG_DEBUG("SpriteSheetLoader") << texturePath << ": "
+                                   << info.frameCount << " frames, "
+                                   << info.frameWidth << "x" << info.frameHeight << " each (total: "
+                                   << info.totalWidth << "x" << info.totalHeight << ")";
     
     return engine::ECS::SpriteAnimation{
         info.frameCount,    // frameCount
@@ -83,25 +84,22 @@ SpriteSheetInfo SpriteSheetLoader::DetectFrames(const std::string& texturePath,
     }
     
     // Load or get existing texture
-    SDL_Texture* texture = resourceManager_->GetTexture(texturePath);
-    if (!texture) {
-        texture = resourceManager_->LoadTexture(texturePath);
+    engine::resources::TextureHandle handle = resourceManager_->GetTextureHandle(texturePath);
+    if (!handle.IsValid()) {
+        handle = resourceManager_->LoadTextureHandle(texturePath);
     }
     
-    if (!texture) {
-        std::cout << "[SpriteSheetLoader] Error: Could not load texture " << texturePath << std::endl;
+    const engine::resources::TextureRegion* region = resourceManager_->GetTextureRegion(handle);
+    if (!region) {
+        LOG_ERROR("SpriteSheetLoader") << "Could not load texture " << texturePath;
         return info;
     }
     
-    // Get texture dimensions
-    float width, height;
-    if (!SDL_GetTextureSize(texture, &width, &height)) {
-        std::cout << "[SpriteSheetLoader] Error: Could not get texture size for " << texturePath << std::endl;
-        return info;
-    }
-    
-    info.totalWidth = static_cast<int>(width);
-    info.totalHeight = static_cast<int>(height);
+    // The sheet's own dimensions; with an atlas, region is its place in the page
+    info.texture = handle;
+    info.region = region->rect;
+    info.totalWidth = region->rect.w;
+    info.totalHeight = region->rect.h;
     
     // Determine frame count
     if (expectedFrameCount > 0) {
@@ -122,6 +120,14 @@ SpriteSheetInfo SpriteSheetLoader::DetectFrames(const std::string& texturePath,
     return info;
 }
 
+SDL_Rect SpriteSheetLoader::GetFrameRect(const SpriteSheetInfo& info, int frame) {
+    if (!info.isValid) {
+        return {0, 0, 0, 0};
+    }
+    frame = std::clamp(frame, 0, info.frameCount - 1);
+    return {info.region.x + frame * info.frameWidth, info.region.y, info.frameWidth, info.frameHeight};
+}
+
 int SpriteSheetLoader::GuessFrameCount(int totalWidth, int totalHeight) {
     // Check for specific known sprite patterns first
     if (totalWidth == 768 && totalHeight == 128) {
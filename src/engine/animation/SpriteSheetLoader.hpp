@@ -15,6 +15,11 @@ struct SpriteSheetInfo {
     int frameWidth = 0;
     int frameHeight = 0;
     bool isValid = false;
+    
+    // Where the sheet lives: its texture, and its rect in that texture (the
+    // whole texture, or a sub-rect when packed into an atlas page)
+    engine::resources::TextureHandle texture;
+    SDL_Rect region = {0, 0, 0, 0};
 };
 
 class SpriteSheetLoader {
@@ -38,6 +43,11 @@ public:
                                                  float frameDuration = 0.1f,
                                                  bool loop = true);
 
+    // Frame rect in texture space (atlas page coordinates when packed), for
+    // drawing straight from the texture. Sprite2D::sourceRect stays relative
+    // to the sheet; RenderSystem adds the region offset itself.
+    static SDL_Rect GetFrameRect(const SpriteSheetInfo& info, int frame);
+
 private:
     engine::resources::ResourceManager* resourceManager_;
     std::unordered_map<std::string, SpriteSheetInfo> cache_;
@@ -0,0 +1,60 @@
+// src/engine/core/ecs/CommandBuffer.cpp
+
+#include "CommandBuffer.hpp"
+#include "World.hpp"
+#include "engine/core/log/Logger.hpp"
+
+namespace engine::ECS {
+
+EntityID CommandBuffer::CreateEntity(const std::string& name) {
+    if (!world_) {
+        LOG_ERROR("CommandBuffer") << "CreateEntity called with no world set";
+        return INVALID_ENTITY;
+    }
+    // EntityFactory is internally synchronised, so reserving here is safe
+    return world_->GetEntityFactory().CreateEntity(name);
+}
+
+void CommandBuffer::Flush() {
+    if (commands_.empty()) {
+        return;
+    }
+    if (!world_) {
+        LOG_ERROR("CommandBuffer") << "Flush called with no world set, dropping "
+                                   << commands_.size() << " commands";
+    } else {
+        auto& entityFactory = world_->GetEntityFactory();
+        auto& componentManager = world_->GetComponentManager();
+
+        // Index loop and a copied command: observers fired by these changes may
+        // record into this same buffer, and those commands are applied too
+        for (size_t i = 0; i < commands_.size(); ++i) {
+            const Command command = commands_[i];
+            // Entities destroyed earlier in this batch (or elsewhere) are skipped
+            if (!entityFactory.IsValid(command.entity)) {
+                continue;
+            }
+            switch (command.type) {
+                case CommandType::Destroy:
+                    componentManager.RemoveAllComponents(command.entity);
+                    entityFactory.DestroyEntity(command.entity);
+                    break;
+                case CommandType::Add:
+                    command.pending->Add(componentManager, command.entity, command.slot);
+                    break;
+                case CommandType::Remove:
+                    command.pending->Remove(componentManager, command.entity);
+                    break;
+            }
+        }
+    }
+
+    commands_.clear();
+    for (auto& pending : pending_) {
+        if (pending) {
+            pending->Clear();
+        }
+    }
+}
+
+} // namespace engine::ECS
@@ -0,0 +1,112 @@
+// src/engine/core/ecs/CommandBuffer.hpp
+
+#pragma once
+
+#include "EntityHandle.hpp"
+#include "ComponentManager.hpp"
+#include <vector>
+#include <memory>
+#include <string>
+
+namespace engine::ECS {
+
+class World; // Forward declaration
+
+// Records structural changes (create/destroy/add/remove) so they can be
+// applied in one batch at a sync point instead of mid-iteration.
+//
+// CreateEntity() reserves the ID immediately so follow-up AddComponent()
+// calls can refer to it; the entity has no components until Flush().
+// Commands are applied in the order they were recorded. Buffers keep their
+// capacity between frames, so steady-state recording does not allocate.
+//
+// A buffer is not thread-safe on its own; each System owns one, and World
+// owns a shared one for code running outside of systems.
+class CommandBuffer {
+public:
+    CommandBuffer() = default;
+    ~CommandBuffer() = default;
+
+    CommandBuffer(const CommandBuffer&) = delete;
+    CommandBuffer& operator=(const CommandBuffer&) = delete;
+
+    void SetWorld(World* world) { world_ = world; }
+
+    EntityID CreateEntity(const std::string& name = "");
+
+    // Removes all of the entity's components, then frees its ID
+    void DestroyEntity(EntityID id) {
+        commands_.push_back({CommandType::Destroy, id, nullptr, 0});
+    }
+
+    template<typename T>
+    void AddComponent(EntityID id, T component) {
+        auto& pending = GetPending<T>();
+        uint32_t slot = static_cast<uint32_t>(pending.components.size());
+        pending.components.push_back(std::move(component));
+        commands_.push_back({CommandType::Add, id, &pending, slot});
+    }
+
+    template<typename T>
+    void RemoveComponent(EntityID id) {
+        commands_.push_back({CommandType::Remove, id, &GetPending<T>(), 0});
+    }
+
+    // Applies and clears all recorded commands, including any recorded by
+    // observers while the flush runs
+    void Flush();
+
+    bool IsEmpty() const { return commands_.empty(); }
+    size_t GetCommandCount() const { return commands_.size(); }
+
+private:
+    enum class CommandType : uint8_t { Destroy, Add, Remove };
+
+    // Typed side storage for component payloads, indexed by component type ID
+    class IPendingComponents {
+    public:
+        virtual ~IPendingComponents() = default;
+        virtual void Add(ComponentManager& componentManager, EntityID id, uint32_t slot) = 0;
+        virtual void Remove(ComponentManager& componentManager, EntityID id) = 0;
+        virtual void Clear() = 0;
+    };
+
+    template<typename T>
+    class PendingComponents : public IPendingComponents {
+    public:
+        void Add(ComponentManager& componentManager, EntityID id, uint32_t slot) override {
+            componentManager.AddComponent<T>(id, std::move(components[slot]));
+        }
+        void Remove(ComponentManager& componentManager, EntityID id) override {
+            componentManager.RemoveComponent<T>(id);
+        }
+        void Clear() override { components.clear(); }
+
+        std::vector<T> components;
+    };
+
+    struct Command {
+        CommandType type;
+        EntityID entity;
+        IPendingComponents* pending;
+        uint32_t slot;
+    };
+
+    template<typename T>
+    PendingComponents<T>& GetPending() {
+        ComponentTypeID typeId = GetComponentTypeID<T>();
+        if (typeId >= pending_.size()) {
+            pending_.resize(typeId + 1);
+        }
+        if (!pending_[typeId]) {
+            pending_[typeId] = std::make_unique<PendingComponents<T>>();
+        }
+        return static_cast<PendingComponents<T>&>(*pending_[typeId]);
+    }
+
+    std::vector<Command> commands_;
+    std::vector<std::unique_ptr<IPendingComponents>> pending_;
+    World* world_ = nullptr;
+};
+
+} // namespace engine::ECS
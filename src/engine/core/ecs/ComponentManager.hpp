@@ -1,65 +1,37 @@
 #pragma once
 
-#include <unordered_map>
-#include <typeindex>
+#include "ComponentStore.hpp"
+#include "View.hpp"
 #include <memory>
 #include <stdexcept>
-#include <functional>
 #include <vector>
-#include <algorithm>
-#include <set>
 
 namespace engine::ECS {
 
-using EntityID = uint32_t;
-
-class IComponentStore {
-public:
-    virtual ~IComponentStore() = default;
-    virtual void Remove(EntityID id) = 0;
-};
-
-template<typename T>
-class ComponentStore : public IComponentStore {
+class ComponentManager {
 public:
-    void Add(EntityID id, const T& component) {
-        components_[id] = component;
-    }
-
-    T* Get(EntityID id) {
-        auto it = components_.find(id);
-        return it != components_.end() ? &it->second : nullptr;
-    }
-
-    void Remove(EntityID id) override {
-        components_.erase(id);
-    }
-
-    bool Has(EntityID id) const {
-        return components_.find(id) != components_.end();
+    template<typename T>
+    void AddComponent(EntityID id, T component) {
+        GetOrCreateStore<T>()->Add(id, std::move(component));
     }
 
-    void ForEach(const std::function<void(EntityID, T&)>& fn) {
-        for (auto& [id, comp] : components_) {
-            fn(id, comp);
-        }
+    template<typename T>
+    T* GetComponent(EntityID id) {
+        auto store = GetStore<T>();
+        return store ? store->Get(id) : nullptr;
     }
 
-private:
-    std::unordered_map<EntityID, T> components_;
-};
-
-class ComponentManager {
-public:
+    // GetComponent() that stamps the component as changed this tick
     template<typename T>
-    void AddComponent(EntityID id, const T& component) {
-        GetOrCreateStore<T>()->Add(id, component);
+    T* GetMutableComponent(EntityID id) {
+        auto store = GetStore<T>();
+        return store ? store->GetMutable(id) : nullptr;
     }
 
     template<typename T>
-    T* GetComponent(EntityID id) {
+    void MarkChanged(EntityID id) {
         auto store = GetStore<T>();
-        return store ? store->Get(id) : nullptr;
+        if (store) store->MarkChanged(id);
     }
 
     template<typename T>
@@ -74,88 +46,135 @@ public:
         if (store) store->Remove(id);
     }
 
-    template<typename T>
-    void ForEachComponent(const std::function<void(EntityID, T&)>& fn) {
+    template<typename T, typename Fn>
+    void ForEachComponent(Fn&& fn) {
         auto store = GetStore<T>();
-        if (store) store->ForEach(fn);
+        if (store) store->ForEach(std::forward<Fn>(fn));
+    }
+
+    // Zero-allocation iteration over entities that have all of Ts
+    template<typename... Ts>
+    View<Ts...> GetView() {
+        return View<Ts...>(GetStore<Ts>()...);
     }
 
     template<typename T>
     std::vector<EntityID> GetEntitiesWithComponent() {
-        std::vector<EntityID> entities;
         auto store = GetStore<T>();
-        if (store) {
-            store->ForEach([&entities](EntityID id, T&) {
-                entities.push_back(id);
-            });
-        }
-        return entities;
+        return store ? store->Entities() : std::vector<EntityID>{};
     }
 
-    template<typename T, typename U>
+    // Snapshot of matching IDs, for callers that create/destroy entities while
+    // walking the result. Prefer GetView() for plain per-frame iteration.
+    template<typename T, typename U, typename... Rest>
     std::vector<EntityID> GetEntitiesWithComponents() {
-        auto entitiesT = GetEntitiesWithComponent<T>();
-        auto entitiesU = GetEntitiesWithComponent<U>();
-        
+        auto view = GetView<T, U, Rest...>();
         std::vector<EntityID> result;
-        std::sort(entitiesT.begin(), entitiesT.end());
-        std::sort(entitiesU.begin(), entitiesU.end());
-        
-        std::set_intersection(entitiesT.begin(), entitiesT.end(),
-                             entitiesU.begin(), entitiesU.end(),
-                             std::back_inserter(result));
+        result.reserve(view.SizeHint());
+        for (auto&& entry : view) {
+            result.push_back(std::get<0>(entry));
+        }
         return result;
     }
 
-    template<typename T, typename U, typename V>
-    std::vector<EntityID> GetEntitiesWithComponents() {
-        auto entitiesT = GetEntitiesWithComponent<T>();
-        auto entitiesU = GetEntitiesWithComponent<U>();
-        auto entitiesV = GetEntitiesWithComponent<V>();
-
-        std::vector<EntityID> result;
-        std::sort(entitiesT.begin(), entitiesT.end());
-        std::sort(entitiesU.begin(), entitiesU.end());
-        std::sort(entitiesV.begin(), entitiesV.end());
-        
-        std::set_intersection(entitiesT.begin(), entitiesT.end(),
-                             entitiesU.begin(), entitiesU.end(),
-                             std::back_inserter(result));
-
-        std::vector<EntityID> finalResult;
-        std::sort(result.begin(), result.end());
-        std::set_intersection(result.begin(), result.end(),
-                             entitiesV.begin(), entitiesV.end(),
-                             std::back_inserter(finalResult));
-        return finalResult;
-    }
-
     // Remove all components for a given entity
     void RemoveAllComponents(EntityID entityId) {
-        for (auto& [typeIndex, store] : stores_) {
+        for (auto& store : stores_) {
             if (store) {
                 store->Remove(entityId);
             }
         }
     }
 
+    // Remove every component of every type; stores and their capacity are kept
+    void ClearAllComponents() {
+        for (auto& store : stores_) {
+            if (store) {
+                store->Clear();
+            }
+        }
+    }
+
+    // Lifecycle observers for component type T. fn(EntityID, T&) runs right
+    // after an add/replace and right before a remove (including entity
+    // destruction and ClearAllComponents). Keep the handle to unregister.
+    // Callbacks run while the store is mid-mutation: they must not add or
+    // remove components, destroy entities or (un)register observers. Record
+    // those on a CommandBuffer (e.g. World::GetCommandBuffer()) instead.
+    struct ObserverHandle {
+        ComponentTypeID type = 0;
+        ObserverID id = 0;
+    };
+
+    template<typename T>
+    ObserverHandle OnAdd(typename ComponentStore<T>::Observer fn) {
+        return AddObserver<T>(ComponentEvent::Add, std::move(fn));
+    }
+
+    template<typename T>
+    ObserverHandle OnRemove(typename ComponentStore<T>::Observer fn) {
+        return AddObserver<T>(ComponentEvent::Remove, std::move(fn));
+    }
+
+    template<typename T>
+    ObserverHandle OnReplace(typename ComponentStore<T>::Observer fn) {
+        return AddObserver<T>(ComponentEvent::Replace, std::move(fn));
+    }
+
+    void RemoveObserver(const ObserverHandle& handle) {
+        if (handle.id != 0 && handle.type < stores_.size() && stores_[handle.type]) {
+            stores_[handle.type]->RemoveObserver(handle.id);
+        }
+    }
+
+    // Current change tick; writes stamped after this are "changed since" it
+    ChangeTick GetChangeTick() const { return changeTick_; }
+
+    // Called by SystemManager at sync points, never while systems run
+    ChangeTick AdvanceChangeTick() {
+        if (++changeTick_ == 0) {
+            changeTick_ = 1;  // 0 is reserved for "no component"
+        }
+        return changeTick_;
+    }
+
+    // Creates the store if needed. The returned pointer stays valid for the
+    // lifetime of the ComponentManager, so systems may cache it in Init().
+    template<typename T>
+    ComponentStore<T>* GetComponentStore() {
+        return GetOrCreateStore<T>();
+    }
+
 private:
-    std::unordered_map<std::type_index, std::unique_ptr<IComponentStore>> stores_;
+    // Indexed by GetComponentTypeID<T>(); null for types never stored here
+    std::vector<std::unique_ptr<IComponentStore>> stores_;
+    ChangeTick changeTick_ = 1;
 
     template<typename T>
     ComponentStore<T>* GetOrCreateStore() {
-        auto index = std::type_index(typeid(T));
-        if (stores_.count(index) == 0) {
-            stores_[index] = std::make_unique<ComponentStore<T>>();
+        ComponentTypeID typeId = GetComponentTypeID<T>();
+        if (typeId >= stores_.size()) {
+            stores_.resize(typeId + 1);
         }
-        return static_cast<ComponentStore<T>*>(stores_[index].get());
+        if (!stores_[typeId]) {
+            auto store = std::make_unique<ComponentStore<T>>();
+            store->SetChangeTickSource(&changeTick_);
+            stores_[typeId] = std::move(store);
+        }
+        return static_cast<ComponentStore<T>*>(stores_[typeId].get());
+    }
+
+    template<typename T>
+    ObserverHandle AddObserver(ComponentEvent event, typename ComponentStore<T>::Observer fn) {
+        ObserverID id = GetOrCreateStore<T>()->AddObserver(event, std::move(fn));
+        return {GetComponentTypeID<T>(), id};
     }
 
     template<typename T>
     ComponentStore<T>* GetStore() {
-        auto it = stores_.find(std::type_index(typeid(T)));
-        if (it != stores_.end())
-            return static_cast<ComponentStore<T>*>(it->second.get());
+        ComponentTypeID typeId = GetComponentTypeID<T>();
+        if (typeId < stores_.size())
+            return static_cast<ComponentStore<T>*>(stores_[typeId].get());
         return nullptr;
     }
 };
@@ -0,0 +1,287 @@
+// src/engine/core/ecs/ComponentStore.hpp
+
+#pragma once
+
+#include "EntityHandle.hpp"
+#include "engine/core/job/JobSystem.hpp"
+#include <vector>
+#include <array>
+#include <memory>
+#include <limits>
+#include <cstdint>
+#include <atomic>
+#include <type_traits>
+#include <functional>
+#include <algorithm>
+#include <cassert>
+
+namespace engine::ECS {
+
+using ComponentTypeID = uint32_t;
+
+namespace detail {
+inline ComponentTypeID NextComponentTypeID() {
+    static std::atomic<ComponentTypeID> counter{0};
+    return counter.fetch_add(1, std::memory_order_relaxed);
+}
+} // namespace detail
+
+// Dense per-type index, assigned on first use and stable for the process
+template<typename T>
+inline ComponentTypeID GetComponentTypeID() {
+    static const ComponentTypeID id = detail::NextComponentTypeID();
+    return id;
+}
+
+// Default ParallelForEach chunk: enough entities that one chunk's components
+// (plus IDs) fill roughly half of a typical 32KB L1 data cache
+template<typename... Ts>
+constexpr size_t DefaultChunkSize() {
+    constexpr size_t bytesPerEntity = sizeof(EntityID) + (sizeof(Ts) + ...);
+    constexpr size_t chunk = (16 * 1024) / bytesPerEntity;
+    return chunk < 64 ? 64 : chunk;
+}
+
+// Change ticks: ComponentManager advances a tick at every scheduler sync
+// point and stores stamp components with it when they are added or written
+// through a tracked accessor. 0 means "no component". Comparisons are
+// wrap-safe as long as a reader looks again within 2^31 ticks.
+using ChangeTick = uint32_t;
+
+constexpr bool IsTickNewer(ChangeTick version, ChangeTick sinceTick) {
+    return version != 0 && static_cast<int32_t>(version - sinceTick) > 0;
+}
+
+// Lifecycle points a store can report to observers
+enum class ComponentEvent : uint8_t {
+    Add,      // After the component is stored
+    Remove,   // Before the component is dropped
+    Replace   // After an existing component is overwritten by Add()
+};
+
+using ObserverID = uint32_t;
+
+class IComponentStore {
+public:
+    virtual ~IComponentStore() = default;
+    virtual void Remove(EntityID id) = 0;
+    virtual void Clear() = 0;
+    virtual void RemoveObserver(ObserverID id) = 0;
+};
+
+// Sparse-set storage: components live packed in dense_, entities_ mirrors
+// dense_ slot-for-slot, and a paged sparse index maps the entity's slot index
+// to its dense slot. Lookups compare the full handle, so stale handles miss.
+// Removal swaps the last element into the hole, so pointers returned by Get()
+// are only valid until the next Add/Remove on this store.
+//
+// versions_ holds the change tick each component was last stamped with.
+// Get() does not stamp; write through GetMutable() or call MarkChanged() so
+// Changed<T> filters see the write.
+//
+// Observers run synchronously on the thread making the change, while the
+// store is mid-mutation. They may read any store and record into a
+// CommandBuffer, but must not make structural changes themselves: no adding
+// or removing components or entities and no (un)registering observers.
+// Queue those on a CommandBuffer instead. Debug builds assert on this store.
+template<typename T>
+class ComponentStore : public IComponentStore {
+public:
+    using Observer = std::function<void(EntityID, T&)>;
+
+    void Add(EntityID id, T component) {
+        assert(notifyDepth_ == 0 && "ComponentStore::Add called from an observer");
+        uint32_t& slot = SparseSlot(id);
+        if (slot != INVALID_INDEX) {
+            if (entities_[slot] == id) {
+                dense_[slot] = std::move(component);
+                versions_[slot] = CurrentTick();
+                Notify(ComponentEvent::Replace, id, dense_[slot]);
+                return;
+            }
+            // A recycled index takes over a stale slot: old owner's component goes
+            uint32_t index = slot;
+            Notify(ComponentEvent::Remove, entities_[index], dense_[index]);
+            entities_[index] = id;
+            dense_[index] = std::move(component);
+            versions_[index] = CurrentTick();
+            Notify(ComponentEvent::Add, id, dense_[index]);
+            return;
+        }
+        slot = static_cast<uint32_t>(dense_.size());
+        dense_.push_back(std::move(component));
+        entities_.push_back(id);
+        versions_.push_back(CurrentTick());
+        Notify(ComponentEvent::Add, id, dense_.back());
+    }
+
+    T* Get(EntityID id) {
+        uint32_t index = IndexOf(id);
+        return index != INVALID_INDEX ? &dense_[index] : nullptr;
+    }
+
+    // Get() that also applies a Changed<T> filter: null unless the component
+    // was stamped after sinceTick
+    T* GetIfChangedSince(EntityID id, ChangeTick sinceTick) {
+        uint32_t index = IndexOf(id);
+        return index != INVALID_INDEX && IsTickNewer(versions_[index], sinceTick) ? &dense_[index] : nullptr;
+    }
+
+    // Get() that also stamps the component as changed
+    T* GetMutable(EntityID id) {
+        uint32_t index = IndexOf(id);
+        if (index == INVALID_INDEX) return nullptr;
+        versions_[index] = CurrentTick();
+        return &dense_[index];
+    }
+
+    void MarkChanged(EntityID id) {
+        uint32_t index = IndexOf(id);
+        if (index != INVALID_INDEX) {
+            versions_[index] = CurrentTick();
+        }
+    }
+
+    // Tick of the last add/tracked write, or 0 if id has no component here
+    ChangeTick GetVersion(EntityID id) const {
+        uint32_t index = IndexOf(id);
+        return index != INVALID_INDEX ? versions_[index] : 0;
+    }
+
+    bool IsChangedSince(EntityID id, ChangeTick sinceTick) const {
+        return IsTickNewer(GetVersion(id), sinceTick);
+    }
+
+    ObserverID AddObserver(ComponentEvent event, Observer fn) {
+        assert(notifyDepth_ == 0 && "ComponentStore::AddObserver called from an observer");
+        ObserverID id = ++lastObserverId_;
+        observers_.push_back({id, event, std::move(fn)});
+        return id;
+    }
+
+    void RemoveObserver(ObserverID id) override {
+        assert(notifyDepth_ == 0 && "ComponentStore::RemoveObserver called from an observer");
+        observers_.erase(std::remove_if(observers_.begin(), observers_.end(),
+            [id](const ObserverEntry& entry) { return entry.id == id; }), observers_.end());
+    }
+
+    // Set by ComponentManager; a store on its own stamps everything with tick 1
+    void SetChangeTickSource(const ChangeTick* tick) { changeTick_ = tick; }
+
+    void Remove(EntityID id) override {
+        assert(notifyDepth_ == 0 && "ComponentStore::Remove called from an observer");
+        uint32_t index = IndexOf(id);
+        if (index == INVALID_INDEX) return;
+
+        Notify(ComponentEvent::Remove, id, dense_[index]);
+
+        uint32_t last = static_cast<uint32_t>(dense_.size() - 1);
+        if (index != last) {
+            dense_[index] = std::move(dense_[last]);
+            entities_[index] = entities_[last];
+            versions_[index] = versions_[last];
+            SparseSlot(entities_[index]) = index;
+        }
+        dense_.pop_back();
+        entities_.pop_back();
+        versions_.pop_back();
+        SparseSlot(id) = INVALID_INDEX;
+    }
+
+    // Drops every component but keeps allocated capacity and sparse pages
+    void Clear() override {
+        assert(notifyDepth_ == 0 && "ComponentStore::Clear called from an observer");
+        for (size_t i = 0; i < dense_.size(); ++i) {
+            Notify(ComponentEvent::Remove, entities_[i], dense_[i]);
+            SparseSlot(entities_[i]) = INVALID_INDEX;
+        }
+        dense_.clear();
+        entities_.clear();
+        versions_.clear();
+    }
+
+    bool Has(EntityID id) const {
+        return IndexOf(id) != INVALID_INDEX;
+    }
+
+    // Calls fn(EntityID, T&) for every component, in dense order
+    template<typename Fn>
+    void ForEach(Fn&& fn) {
+        for (size_t i = 0; i < dense_.size(); ++i) {
+            fn(entities_[i], dense_[i]);
+        }
+    }
+
+    // Same as ForEach, with the dense array split into chunks that run across
+    // the job system. fn must only touch the component it is given (and other
+    // stores read-only); structural changes go through a CommandBuffer.
+    template<typename Fn>
+    void ParallelForEach(job::JobSystem& jobSystem, Fn&& fn, size_t chunkSize = DefaultChunkSize<T>()) {
+        jobSystem.ParallelFor(0, dense_.size(), chunkSize, [this, &fn](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                fn(entities_[i], dense_[i]);
+            }
+        });
+    }
+
+    size_t Size() const { return dense_.size(); }
+    const std::vector<EntityID>& Entities() const { return entities_; }
+
+private:
+    static constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+    static constexpr uint32_t PAGE_SHIFT = 12;
+    static constexpr uint32_t PAGE_SIZE = 1u << PAGE_SHIFT;
+    using SparsePage = std::array<uint32_t, PAGE_SIZE>;
+
+    struct ObserverEntry {
+        ObserverID id;
+        ComponentEvent event;
+        Observer fn;
+    };
+
+    ChangeTick CurrentTick() const { return changeTick_ ? *changeTick_ : 1; }
+
+    void Notify(ComponentEvent event, EntityID id, T& component) {
+        if (observers_.empty()) return;
+        ++notifyDepth_;
+        for (auto& observer : observers_) {
+            if (observer.event == event) {
+                observer.fn(id, component);
+            }
+        }
+        --notifyDepth_;
+    }
+
+    uint32_t IndexOf(EntityID id) const {
+        uint32_t index = GetEntityIndex(id);
+        size_t page = index >> PAGE_SHIFT;
+        if (page >= sparse_.size() || !sparse_[page]) return INVALID_INDEX;
+        uint32_t slot = (*sparse_[page])[index & (PAGE_SIZE - 1)];
+        return (slot != INVALID_INDEX && entities_[slot] == id) ? slot : INVALID_INDEX;
+    }
+
+    // Returns the sparse slot for id's index, allocating its page on first touch
+    uint32_t& SparseSlot(EntityID id) {
+        uint32_t index = GetEntityIndex(id);
+        size_t page = index >> PAGE_SHIFT;
+        if (page >= sparse_.size()) {
+            sparse_.resize(page + 1);
+        }
+        if (!sparse_[page]) {
+            sparse_[page] = std::make_unique<SparsePage>();
+            sparse_[page]->fill(INVALID_INDEX);
+        }
+        return (*sparse_[page])[index & (PAGE_SIZE - 1)];
+    }
+
+    std::vector<T> dense_;
+    std::vector<EntityID> entities_;
+    std::vector<ChangeTick> versions_;
+    std::vector<std::unique_ptr<SparsePage>> sparse_;
+    const ChangeTick* changeTick_ = nullptr;
+    std::vector<ObserverEntry> observers_;
+    ObserverID lastObserverId_ = 0;
+    uint32_t notifyDepth_ = 0;
+};
+
+} // namespace engine::ECS
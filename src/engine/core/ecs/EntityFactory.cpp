@@ -1,19 +1,38 @@
 // src/engine/core/ecs/EntityFactory.cpp
 
 #include "EntityFactory.hpp"
+#include "engine/core/log/Logger.hpp"
 #include <algorithm>
 
 namespace engine::ECS {
 
-EntityFactory::EntityFactory() : nextId_(1), totalCreated_(0) {}
+EntityFactory::EntityFactory() : nextIndex_(1), totalCreated_(0) {}
 
 EntityID EntityFactory::CreateEntity(const std::string& name) {
     std::lock_guard<std::mutex> lock(mutex_);
     
-    // Use unique IDs - no reuse to avoid component conflicts
-    EntityID id = nextId_++;
+    // Recycle destroyed slots first so sparse-set indices stay small
+    uint32_t index;
+    bool freshIndex = freeIndices_.empty();
+    if (!freshIndex) {
+        index = freeIndices_.back();
+        freeIndices_.pop_back();
+    } else {
+        index = nextIndex_.load(std::memory_order_relaxed);
+        if (index > MAX_ENTITY_INDEX) {
+            LOG_ERROR("EntityFactory") << "Entity limit reached (" << MAX_ENTITY_INDEX << ")";
+            return INVALID_ENTITY;
+        }
+        generations_.resize(index + 1, 0);
+    }
+    
+    EntityID id = MakeEntityID(index, generations_[index]);
+    GetOrCreateSlot(index).store(id, std::memory_order_release);
+    if (freshIndex) {
+        nextIndex_.store(index + 1, std::memory_order_release);
+    }
     
-    activeIds_.insert(id);
+    activeCount_.fetch_add(1, std::memory_order_relaxed);
     totalCreated_++;
     return id;
 }
@@ -21,28 +40,57 @@ EntityID EntityFactory::CreateEntity(const std::string& name) {
 void EntityFactory::DestroyEntity(EntityID id) {
     std::lock_guard<std::mutex> lock(mutex_);
     
-    if (activeIds_.find(id) != activeIds_.end()) {
-        activeIds_.erase(id);
-        // No longer add to availableIds_ - use unique IDs only
+    auto* slot = FindSlot(GetEntityIndex(id));
+    if (id == INVALID_ENTITY || !slot || slot->load(std::memory_order_relaxed) != id) {
+        #ifdef DEBUG
+        LOG_DEBUG("EntityFactory") << "Ignoring destroy of stale or unknown entity " << id;
+        #endif
+        return;
     }
+    
+    uint32_t index = GetEntityIndex(id);
+    slot->store(INVALID_ENTITY, std::memory_order_release);
+    generations_[index] = static_cast<uint16_t>((generations_[index] + 1) & ENTITY_GENERATION_MASK);
+    freeIndices_.push_back(index);
+    activeCount_.fetch_sub(1, std::memory_order_relaxed);
 }
 
 bool EntityFactory::IsValid(EntityID id) const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return activeIds_.find(id) != activeIds_.end();
+    if (id == INVALID_ENTITY) {
+        return false;
+    }
+    auto* slot = FindSlot(GetEntityIndex(id));
+    return slot && slot->load(std::memory_order_acquire) == id;
+}
+
+bool EntityFactory::IsStale(EntityID id) const {
+    if (id == INVALID_ENTITY) {
+        return false;
+    }
+    // The index has been handed out before but no longer holds this handle
+    return GetEntityIndex(id) < nextIndex_.load(std::memory_order_acquire) && !IsValid(id);
 }
 
 void EntityFactory::ClearAll() {
     std::lock_guard<std::mutex> lock(mutex_);
-    activeIds_.clear();
-    availableIds_.clear();  // Keep for consistency, though no longer used
-    nextId_ = 1;
+    
+    // Invalidate every live handle and return all indices to the free list;
+    // generations keep counting so handles from before the clear stay stale
+    freeIndices_.clear();
+    for (uint32_t index = nextIndex_.load(std::memory_order_relaxed) - 1; index >= 1; --index) {
+        auto* slot = FindSlot(index);
+        if (slot && slot->load(std::memory_order_relaxed) != INVALID_ENTITY) {
+            slot->store(INVALID_ENTITY, std::memory_order_release);
+            generations_[index] = static_cast<uint16_t>((generations_[index] + 1) & ENTITY_GENERATION_MASK);
+        }
+        freeIndices_.push_back(index);
+    }
+    activeCount_.store(0, std::memory_order_relaxed);
     totalCreated_ = 0;
 }
 
 size_t EntityFactory::GetActiveEntityCount() const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return activeIds_.size();
+    return activeCount_.load(std::memory_order_relaxed);
 }
 
 size_t EntityFactory::GetTotalCreatedCount() const {
@@ -50,4 +98,26 @@ size_t EntityFactory::GetTotalCreatedCount() const {
     return totalCreated_;
 }
 
+size_t EntityFactory::GetFreeIndexCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return freeIndices_.size();
+}
+
+std::atomic<EntityID>* EntityFactory::FindSlot(uint32_t index) const {
+    auto* page = slotPages_[index >> SLOT_PAGE_SHIFT].load(std::memory_order_acquire);
+    return page ? &page[index & (SLOT_PAGE_SIZE - 1)] : nullptr;
+}
+
+std::atomic<EntityID>& EntityFactory::GetOrCreateSlot(uint32_t index) {
+    auto& pageRef = slotPages_[index >> SLOT_PAGE_SHIFT];
+    auto* page = pageRef.load(std::memory_order_acquire);
+    if (!page) {
+        // Value-initialised: every slot starts as INVALID_ENTITY
+        ownedPages_.push_back(std::make_unique<std::atomic<EntityID>[]>(SLOT_PAGE_SIZE));
+        page = ownedPages_.back().get();
+        pageRef.store(page, std::memory_order_release);
+    }
+    return page[index & (SLOT_PAGE_SIZE - 1)];
+}
+
 } // namespace engine::ECS
@@ -1,14 +1,21 @@
 #pragma once
 
+#include "EntityHandle.hpp"
 #include <vector>
-#include <unordered_set>
+#include <array>
 #include <string>
 #include <mutex>
+#include <atomic>
+#include <memory>
 
 namespace engine::ECS {
 
-using EntityID = uint32_t;
+class World;
+class CommandBuffer;
 
+// Hands out entity IDs. Destroying only frees the ID, so it is private:
+// World::DestroyEntity() and CommandBuffer::DestroyEntity() remove the
+// entity's components (firing Remove observers) before freeing it.
 class EntityFactory {
 public:
     EntityFactory();
@@ -16,20 +23,42 @@ public:
 
     // Core functionality
     EntityID CreateEntity(const std::string& name = "");
-    void DestroyEntity(EntityID id);
-    bool IsValid(EntityID id) const;
-    void ClearAll();
+    bool IsValid(EntityID id) const;   // Lock-free, O(1)
+    bool IsStale(EntityID id) const;   // Handle to a slot that has since been destroyed or reused
     
     // Utility
     size_t GetActiveEntityCount() const;
     size_t GetTotalCreatedCount() const;
+    size_t GetFreeIndexCount() const;
 
 private:
-    std::vector<EntityID> availableIds_;
-    std::unordered_set<EntityID> activeIds_;
-    EntityID nextId_ = 1;
+    friend class World;
+    friend class CommandBuffer;
+
+    // ID only; callers must have removed the entity's components already
+    void DestroyEntity(EntityID id);
+    void ClearAll();
+
+    static constexpr uint32_t SLOT_PAGE_SHIFT = 12;
+    static constexpr uint32_t SLOT_PAGE_SIZE = 1u << SLOT_PAGE_SHIFT;
+    static constexpr uint32_t SLOT_PAGE_COUNT = (MAX_ENTITY_INDEX >> SLOT_PAGE_SHIFT) + 1;
+
+    // Live handle per slot index (INVALID_ENTITY when dead). Pages are published
+    // atomically and never freed while the factory lives, so readers need no lock.
+    std::atomic<EntityID>* FindSlot(uint32_t index) const;
+    std::atomic<EntityID>& GetOrCreateSlot(uint32_t index);
+
+    std::array<std::atomic<std::atomic<EntityID>*>, SLOT_PAGE_COUNT> slotPages_{};
+    std::vector<std::unique_ptr<std::atomic<EntityID>[]>> ownedPages_;
+
+    std::vector<uint16_t> generations_;   // Next generation to hand out, per index
+    std::vector<uint32_t> freeIndices_;
+    // Indices below this have been handed out at least once. Written under
+    // mutex_ after the slot is published; read lock-free by IsStale().
+    std::atomic<uint32_t> nextIndex_{1};  // Index 0 is reserved for INVALID_ENTITY
+    std::atomic<size_t> activeCount_{0};
     size_t totalCreated_ = 0;
     mutable std::mutex mutex_;
 };
 
-} // namespace engine::ECS
\ No newline at end of file
+} // namespace engine::ECS
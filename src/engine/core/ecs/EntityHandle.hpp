@@ -0,0 +1,34 @@
+// src/engine/core/ecs/EntityHandle.hpp
+
+#pragma once
+
+#include <cstdint>
+
+namespace engine::ECS {
+
+// An EntityID is a 32-bit handle: the low 20 bits are a slot index that gets
+// recycled, the high 12 bits are that slot's generation. Destroying an entity
+// bumps its slot generation, so old handles to a reused slot no longer match.
+// Index 0 is never allocated, which keeps 0 usable as "no entity".
+using EntityID = uint32_t;
+
+constexpr uint32_t ENTITY_INDEX_BITS = 20;
+constexpr uint32_t ENTITY_GENERATION_BITS = 32 - ENTITY_INDEX_BITS;
+constexpr uint32_t ENTITY_INDEX_MASK = (1u << ENTITY_INDEX_BITS) - 1;
+constexpr uint32_t ENTITY_GENERATION_MASK = (1u << ENTITY_GENERATION_BITS) - 1;
+constexpr uint32_t MAX_ENTITY_INDEX = ENTITY_INDEX_MASK;
+constexpr EntityID INVALID_ENTITY = 0;
+
+constexpr uint32_t GetEntityIndex(EntityID id) {
+    return id & ENTITY_INDEX_MASK;
+}
+
+constexpr uint32_t GetEntityGeneration(EntityID id) {
+    return id >> ENTITY_INDEX_BITS;
+}
+
+constexpr EntityID MakeEntityID(uint32_t index, uint32_t generation) {
+    return ((generation & ENTITY_GENERATION_MASK) << ENTITY_INDEX_BITS) | (index & ENTITY_INDEX_MASK);
+}
+
+} // namespace engine::ECS
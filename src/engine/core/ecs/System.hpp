@@ -2,8 +2,19 @@
 
 #pragma once
 
+#include "CommandBuffer.hpp"
+#include "SystemAccess.hpp"
+
 namespace engine::ECS {
 
+// When a system runs within a frame. Fixed systems step the simulation at
+// the engine's tick rate (zero or more times per frame, constant deltaTime);
+// Render systems run once per frame afterwards with the frame's deltaTime.
+enum class SystemPhase {
+    Fixed,
+    Render
+};
+
 class World; // forward declaration    
 class System {
 public:
@@ -20,13 +31,34 @@ public:
 
     virtual const char* GetName() const { return "UnnamedSystem"; }
 
-    void SetWorld(World* world) { world_ = world; }
+    // Components this system reads/writes; lets SystemManager run
+    // non-conflicting systems in parallel. Default is exclusive.
+    virtual SystemAccess GetAccess() const { return SystemAccess::Exclusive(); }
+
+    // Simulation logic stays Fixed; drawing and purely visual updates are Render
+    virtual SystemPhase GetPhase() const { return SystemPhase::Fixed; }
+
+    void SetWorld(World* world) {
+        world_ = world;
+        commandBuffer_.SetWorld(world);
+    }
     World* GetWorld() const { return world_; }
     World* GetWorld() { return world_; }
 
+    // Structural changes made during Update() go here; SystemManager flushes
+    // it once the system has finished running
+    CommandBuffer& GetCommandBuffer() { return commandBuffer_; }
+
+    // Change tick of this system's previous run (0 before the first one).
+    // Use with View::Changed<T>() to see only what changed since then.
+    ChangeTick GetLastRunTick() const { return lastRunTick_; }
+    void SetLastRunTick(ChangeTick tick) { lastRunTick_ = tick; }
+
 protected:
     bool enabled_ = true;
     World* world_ = nullptr;
+    CommandBuffer commandBuffer_;
+    ChangeTick lastRunTick_ = 0;
 };
 
 } // namespace engine::ECS
\ No newline at end of file
@@ -0,0 +1,105 @@
+// src/engine/core/ecs/SystemAccess.hpp
+
+#pragma once
+
+#include "ComponentManager.hpp"
+#include <vector>
+#include <algorithm>
+
+namespace engine::ECS {
+
+// Declares which component types a system reads and writes during Update().
+// SystemManager uses this to decide which systems may run at the same time:
+// two systems conflict if either writes a type the other touches, or if
+// either is exclusive. Systems that don't override System::GetAccess() are
+// exclusive and keep the old one-at-a-time behaviour.
+//
+//   SystemAccess GetAccess() const override {
+//       return SystemAccess().Read<PhysicsModeComponent>().Write<Transform2D>().Write<Velocity2D>();
+//   }
+class SystemAccess {
+public:
+    SystemAccess() = default;
+
+    // Touches unknown or non-component shared state; runs alone
+    static SystemAccess Exclusive() {
+        SystemAccess access;
+        access.exclusive_ = true;
+        return access;
+    }
+
+    template<typename T>
+    SystemAccess& Read() {
+        Insert(reads_, {GetComponentTypeID<T>(), &EnsureStore<T>});
+        return *this;
+    }
+
+    template<typename T>
+    SystemAccess& Write() {
+        Insert(writes_, {GetComponentTypeID<T>(), &EnsureStore<T>});
+        return *this;
+    }
+
+    // Must run on the thread that owns the SDL renderer/window
+    SystemAccess& MainThread() {
+        mainThread_ = true;
+        return *this;
+    }
+
+    bool IsExclusive() const { return exclusive_; }
+    bool RequiresMainThread() const { return mainThread_; }
+
+    bool ConflictsWith(const SystemAccess& other) const {
+        if (exclusive_ || other.exclusive_) {
+            return true;
+        }
+        return Overlaps(writes_, other.writes_) ||
+               Overlaps(writes_, other.reads_) ||
+               Overlaps(reads_, other.writes_);
+    }
+
+    // Creates every declared store up front, so systems running in parallel
+    // never race on ComponentManager's store table
+    void EnsureStores(ComponentManager& componentManager) const {
+        for (const auto& entry : reads_) entry.ensureStore(componentManager);
+        for (const auto& entry : writes_) entry.ensureStore(componentManager);
+    }
+
+private:
+    struct Entry {
+        ComponentTypeID type;
+        void (*ensureStore)(ComponentManager&);
+
+        bool operator<(const Entry& other) const { return type < other.type; }
+    };
+
+    template<typename T>
+    static void EnsureStore(ComponentManager& componentManager) {
+        componentManager.GetComponentStore<T>();
+    }
+
+    // Kept sorted by type ID so Overlaps() is a linear merge
+    static void Insert(std::vector<Entry>& entries, Entry entry) {
+        auto it = std::lower_bound(entries.begin(), entries.end(), entry);
+        if (it == entries.end() || it->type != entry.type) {
+            entries.insert(it, entry);
+        }
+    }
+
+    static bool Overlaps(const std::vector<Entry>& a, const std::vector<Entry>& b) {
+        auto i = a.begin();
+        auto j = b.begin();
+        while (i != a.end() && j != b.end()) {
+            if (i->type == j->type) return true;
+            if (i->type < j->type) ++i; else ++j;
+        }
+        return false;
+    }
+
+    std::vector<Entry> reads_;
+    std::vector<Entry> writes_;
+    bool exclusive_ = false;
+    bool mainThread_ = false;
+};
+
+} // namespace engine::ECS
@@ -1,12 +1,15 @@
 // src/engine/core/ecs/SystemManager.cpp
 #include "SystemManager.hpp"
-#include <iostream>
+#include "World.hpp"
+#include "engine/core/profiling/TraceProfiler.hpp"
+#include "engine/core/log/Logger.hpp"
+#include <fstream>
 
 namespace engine::ECS {
 
 void SystemManager::AddSystem(std::unique_ptr<System> system, int priority) {
     if (!system) {
-        std::cerr << "[SystemManager] Warning: Attempted to add null system" << std::endl;
+        LOG_WARN("SystemManager") << "Attempted to add null system";
         return;
     }
     
@@ -14,39 +17,40 @@ void SystemManager::AddSystem(std::unique_ptr<System> system, int priority) {
     
     // Check if system already exists
     if (HasSystem(name)) {
-        std::cerr << "[SystemManager] Warning: System '" << name << "' already exists" << std::endl;
+        LOG_WARN("SystemManager") << "System '" << name << "' already exists";
         return;
     }
 
     if (world_) {
         system->SetWorld(world_);
-        std::cout << "[SystemManager] Calling Init() on system: " << name << std::endl;
+        LOG_INFO("SystemManager") << "Calling Init() on system: " << name;
         system->Init();  // Initialize the system after setting world
-        std::cout << "[SystemManager] Init() completed for system: " << name << std::endl;
+        LOG_INFO("SystemManager") << "Init() completed for system: " << name;
     } else {
-        std::cout << "[SystemManager] Warning: No world set, skipping Init() for system: " << name << std::endl;
+        LOG_WARN("SystemManager") << "No world set, skipping Init() for system: " << name;
     }
     
     // Add system
-    systems_.emplace_back(std::move(system), priority);
+    systems_.emplace_back(std::move(system), priority, profilerHistory_);
     systemIndices_[name] = systems_.size() - 1;
     needsSort_ = true;
     
-    std::cout << "[SystemManager] Added system: " << name << " (priority: " << priority << ")" << std::endl;
+    LOG_INFO("SystemManager") << "Added system: " << name << " (priority: " << priority << ")";
 }
 
 void SystemManager::RemoveSystem(const std::string& name) {
     auto it = systemIndices_.find(name);
     if (it == systemIndices_.end()) {
-        std::cerr << "[SystemManager] Warning: System '" << name << "' not found" << std::endl;
+        LOG_WARN("SystemManager") << "System '" << name << "' not found";
         return;
     }
     
     size_t index = it->second;
     
     if (systems_[index].system) {
-        std::cout << "[SystemManager] Shutting down: " << name << std::endl;
+        LOG_INFO("SystemManager") << "Shutting down: " << name;
         systems_[index].system->Shutdown();
+        systems_[index].system->GetCommandBuffer().Flush();
     }
     
     systems_.erase(systems_.begin() + index);
@@ -58,33 +62,169 @@ void SystemManager::RemoveSystem(const std::string& name) {
             sysIndex--;
         }
     }
+    needsSort_ = true;  // Stage indices are stale
     
-    std::cout << "[SystemManager] Removed system: " << name << std::endl;
+    LOG_INFO("SystemManager") << "Removed system: " << name;
 }
 
 void SystemManager::Update(float deltaTime) {
+    UpdatePhase(SystemPhase::Fixed, deltaTime);
+    UpdatePhase(SystemPhase::Render, deltaTime);
+}
+
+void SystemManager::UpdatePhase(SystemPhase phase, float deltaTime) {
+    PROFILE_SCOPE(phase == SystemPhase::Fixed ? "SystemManager::Update (Fixed)" : "SystemManager::Update (Render)");
+
     if (needsSort_) {
         SortSystems();
     }
     
-    for (auto& entry : systems_) {
-        if (!entry.isPaused && entry.system) {
-            entry.system->Update(deltaTime);
+    // Change ticks advance at every sync point, so anything a stage writes or
+    // flushes is stamped newer than the tick its own systems record
+    auto* componentManager = world_ ? &world_->GetComponentManager() : nullptr;
+    auto advanceTick = [componentManager]() -> ChangeTick {
+        return componentManager ? componentManager->AdvanceChangeTick() : 0;
+    };
+    
+    // Sync point: apply changes queued outside of systems since last frame
+    ChangeTick stageTick = advanceTick();
+    if (world_) {
+        world_->GetCommandBuffer().Flush();
+    }
+    
+    for (const auto& stage : stages_[PhaseIndex(phase)]) {
+        RunStage(stage, deltaTime);
+        for (size_t index : stage) {
+            if (!systems_[index].isPaused) {
+                systems_[index].system->SetLastRunTick(stageTick);
+            }
+        }
+        
+        // Sync point: later stages see this stage's structural changes
+        PROFILE_SCOPE("SystemManager::FlushCommandBuffers");
+        stageTick = advanceTick();
+        for (size_t index : stage) {
+            systems_[index].system->GetCommandBuffer().Flush();
         }
     }
+    
+    if (world_) {
+        world_->GetCommandBuffer().Flush();
+    }
+    // Writes between frames (event handlers, scene code) get a fresh tick
+    advanceTick();
+}
+
+void SystemManager::RunStage(const std::vector<size_t>& stage, float deltaTime) {
+    size_t runnable = 0;
+    for (size_t index : stage) {
+        if (!systems_[index].isPaused) {
+            runnable++;
+        }
+    }
+    
+    auto* jobSystem = world_ ? &world_->GetJobSystem() : nullptr;
+    if (!jobSystem || jobSystem->IsSingleThreaded() || runnable < 2) {
+        for (size_t index : stage) {
+            auto& entry = systems_[index];
+            if (!entry.isPaused) {
+                RunSystem(entry, deltaTime);
+            }
+        }
+        return;
+    }
+    
+    stageJobs_.clear();
+    for (size_t index : stage) {
+        auto& entry = systems_[index];
+        if (!entry.isPaused && !entry.access.RequiresMainThread()) {
+            SystemEntry* job = &entry;
+            stageJobs_.push_back(jobSystem->Schedule([this, job, deltaTime] {
+                RunSystem(*job, deltaTime);
+            }));
+        }
+    }
+    
+    // This thread owns the renderer, so it takes main-thread systems itself,
+    // then helps with the rest while waiting
+    for (size_t index : stage) {
+        auto& entry = systems_[index];
+        if (!entry.isPaused && entry.access.RequiresMainThread()) {
+            RunSystem(entry, deltaTime);
+        }
+    }
+    for (const auto& job : stageJobs_) {
+        jobSystem->Wait(job);
+    }
+}
+
+void SystemManager::RunSystem(SystemEntry& entry, float deltaTime) {
+    PROFILE_SCOPE(entry.system->GetName());
+#if ENGINE_SYSTEM_PROFILING
+    if (profilingEnabled_) {
+        auto start = RunTimeHistory::Clock::now();
+        entry.system->Update(deltaTime);
+        entry.timings.Record(RunTimeHistory::Clock::now() - start);
+        return;
+    }
+#endif
+    entry.system->Update(deltaTime);
+}
+
+void SystemManager::RebuildSchedule() {
+    for (auto& stages : stages_) {
+        stages.clear();
+    }
+    std::vector<size_t> stageOf(systems_.size(), 0);
+    
+    for (size_t i = 0; i < systems_.size(); ++i) {
+        auto& entry = systems_[i];
+        entry.access = entry.system->GetAccess();
+        entry.phase = entry.system->GetPhase();
+        if (world_) {
+            entry.access.EnsureStores(world_->GetComponentManager());
+        }
+        
+        // Earlier (higher priority) conflicting systems must finish first;
+        // the phases never overlap, so only the same phase matters
+        size_t stage = 0;
+        for (size_t j = 0; j < i; ++j) {
+            if (systems_[j].phase == entry.phase && entry.access.ConflictsWith(systems_[j].access)) {
+                stage = std::max(stage, stageOf[j] + 1);
+            }
+        }
+        stageOf[i] = stage;
+        auto& stages = stages_[PhaseIndex(entry.phase)];
+        if (stage >= stages.size()) {
+            stages.resize(stage + 1);
+        }
+        stages[stage].push_back(i);
+    }
+    
+    LOG_INFO("SystemManager") << "Scheduled " << systems_.size() << " systems into "
+                              << GetStageCount(SystemPhase::Fixed) << " fixed and "
+                              << GetStageCount(SystemPhase::Render) << " render stages";
+}
+
+size_t SystemManager::GetStageCount() const {
+    size_t count = 0;
+    for (const auto& stages : stages_) {
+        count += stages.size();
+    }
+    return count;
 }
 
 void SystemManager::SetSystemPriority(const std::string& name, int priority) {
     auto it = systemIndices_.find(name);
     if (it == systemIndices_.end()) {
-        std::cerr << "[SystemManager] Warning: System '" << name << "' not found" << std::endl;
+        LOG_WARN("SystemManager") << "System '" << name << "' not found";
         return;
     }
     
     systems_[it->second].priority = priority;
     needsSort_ = true;
     
-    std::cout << "[SystemManager] Set priority for '" << name << "' to " << priority << std::endl;
+    LOG_INFO("SystemManager") << "Set priority for '" << name << "' to " << priority;
 }
 
 void SystemManager::SortSystems() {
@@ -102,6 +242,7 @@ void SystemManager::SortSystems() {
     }
     
     needsSort_ = false;
+    RebuildSchedule();
 }
 
 bool SystemManager::HasSystem(const std::string& name) const {
@@ -120,7 +261,7 @@ void SystemManager::PauseSystem(const std::string& name) {
     auto it = systemIndices_.find(name);
     if (it != systemIndices_.end()) {
         systems_[it->second].isPaused = true;
-        std::cout << "[SystemManager] Paused system: " << name << std::endl;
+        LOG_INFO("SystemManager") << "Paused system: " << name;
     }
 }
 
@@ -128,7 +269,7 @@ void SystemManager::ResumeSystem(const std::string& name) {
     auto it = systemIndices_.find(name);
     if (it != systemIndices_.end()) {
         systems_[it->second].isPaused = false;
-        std::cout << "[SystemManager] Resumed system: " << name << std::endl;
+        LOG_INFO("SystemManager") << "Resumed system: " << name;
     }
 }
 
@@ -136,14 +277,70 @@ void SystemManager::PauseAllSystems() {
     for (auto& entry : systems_) {
         entry.isPaused = true;
     }
-    std::cout << "[SystemManager] Paused all systems" << std::endl;
+    LOG_INFO("SystemManager") << "Paused all systems";
 }
 
 void SystemManager::ResumeAllSystems() {
     for (auto& entry : systems_) {
         entry.isPaused = false;
     }
-    std::cout << "[SystemManager] Resumed all systems" << std::endl;
+    LOG_INFO("SystemManager") << "Resumed all systems";
+}
+
+void SystemManager::SetProfilerHistory(size_t runs) {
+    profilerHistory_ = std::max<size_t>(runs, 1);
+    for (auto& entry : systems_) {
+        entry.timings.SetCapacity(profilerHistory_);
+    }
+}
+
+void SystemManager::ResetSystemTimings() {
+    for (auto& entry : systems_) {
+        entry.timings.Clear();
+    }
+}
+
+std::vector<SystemTimingStats> SystemManager::GetSystemTimings() const {
+    std::vector<SystemTimingStats> stats;
+    stats.reserve(systems_.size());
+    for (const auto& entry : systems_) {
+        if (entry.system) {
+            stats.push_back(entry.timings.ComputeStats(entry.system->GetName()));
+        }
+    }
+    return stats;
+}
+
+SystemTimingStats SystemManager::GetSystemTiming(const std::string& name) const {
+    auto it = systemIndices_.find(name);
+    if (it == systemIndices_.end()) {
+        SystemTimingStats empty;
+        empty.name = name;
+        return empty;
+    }
+    return systems_[it->second].timings.ComputeStats(name);
+}
+
+bool SystemManager::DumpSystemTimingsCSV(const std::string& path) const {
+    std::ofstream file(path);
+    if (!file) {
+        LOG_ERROR("SystemManager") << "Failed to open " << path << " for timing dump";
+        return false;
+    }
+    WriteSystemTimingsCSV(file, GetSystemTimings());
+    LOG_INFO("SystemManager") << "Wrote system timings to " << path;
+    return true;
+}
+
+bool SystemManager::DumpSystemTimingsJSON(const std::string& path) const {
+    std::ofstream file(path);
+    if (!file) {
+        LOG_ERROR("SystemManager") << "Failed to open " << path << " for timing dump";
+        return false;
+    }
+    WriteSystemTimingsJSON(file, GetSystemTimings());
+    LOG_INFO("SystemManager") << "Wrote system timings to " << path;
+    return true;
 }
 
 void SystemManager::ClearAllSystems() {
@@ -155,10 +352,14 @@ void SystemManager::ClearAllSystems() {
     for (auto& entry : systems_) {
         if (entry.system) {
             entry.system->Shutdown();
+            entry.system->GetCommandBuffer().Flush();
         }
     }
     
     systems_.clear();
     systemIndices_.clear();
+    for (auto& stages : stages_) {
+        stages.clear();
+    }
 }
 } // namespace engine::ECS
\ No newline at end of file
@@ -3,12 +3,15 @@
 #pragma once
 
 #include "System.hpp"
+#include "SystemProfiler.hpp"
+#include <array>
 #include <vector>
 #include <unordered_map>
 #include <string>
 #include <memory>
 #include <algorithm>
 #include <iostream>
+#include "engine/core/job/JobSystem.hpp"
 
 namespace engine::ECS {
 
@@ -21,7 +24,10 @@ public:
     
     void AddSystem(std::unique_ptr<System> system, int priority = 0);
     void RemoveSystem(const std::string& name);
+    // Runs the Fixed phase, then the Render phase, with the same deltaTime
     void Update(float deltaTime);
+    // Runs only the systems of one phase (the engine's fixed-timestep loop)
+    void UpdatePhase(SystemPhase phase, float deltaTime);
     void SortSystems();
 
     void SetSystemPriority(const std::string& name, int priority);
@@ -37,14 +43,35 @@ public:
 
     void SetWorld(World* world) { world_ = world; }
 
+    // Number of sync points per pass of each phase in the current schedule
+    size_t GetStageCount() const;
+    size_t GetStageCount(SystemPhase phase) const { return stages_[PhaseIndex(phase)].size(); }
+
+    // Per-system Update() timings over the last N runs (see SystemProfiler.hpp).
+    // Query between frames, not from inside a system.
+    void SetProfilingEnabled(bool enabled) { profilingEnabled_ = enabled; }
+    bool IsProfilingEnabled() const { return ENGINE_SYSTEM_PROFILING && profilingEnabled_; }
+    void SetProfilerHistory(size_t runs);
+    void ResetSystemTimings();
+
+    // In schedule order; systems that haven't run yet report zero samples
+    std::vector<SystemTimingStats> GetSystemTimings() const;
+    SystemTimingStats GetSystemTiming(const std::string& name) const;
+
+    bool DumpSystemTimingsCSV(const std::string& path) const;
+    bool DumpSystemTimingsJSON(const std::string& path) const;
+
 private:
     struct SystemEntry {
         std::unique_ptr<System> system;
         int priority;
         bool isPaused;
+        SystemAccess access;
+        SystemPhase phase = SystemPhase::Fixed;
+        RunTimeHistory timings;
         
-        SystemEntry(std::unique_ptr<System> sys, int prio) 
-            : system(std::move(sys)), priority(prio), isPaused(false) {}
+        SystemEntry(std::unique_ptr<System> sys, int prio, size_t history) 
+            : system(std::move(sys)), priority(prio), isPaused(false), timings(history) {}
         
         // Make move-only since unique_ptr is move-only
         SystemEntry(SystemEntry&&) = default;
@@ -53,10 +80,26 @@ private:
         SystemEntry& operator=(const SystemEntry&) = delete;
     };
     
+    static constexpr size_t PHASE_COUNT = 2;
+    static size_t PhaseIndex(SystemPhase phase) { return static_cast<size_t>(phase); }
+    
+    // Groups each phase's systems (sorted by priority) into stages: a system
+    // goes in the stage after the last earlier system of its phase it
+    // conflicts with, so conflicting systems keep their priority order and
+    // everything else may overlap. Command buffers are flushed at the end of
+    // each stage.
+    void RebuildSchedule();
+    void RunStage(const std::vector<size_t>& stage, float deltaTime);
+    void RunSystem(SystemEntry& entry, float deltaTime);
+
     std::vector<SystemEntry> systems_;
     std::unordered_map<std::string, size_t> systemIndices_;
+    std::array<std::vector<std::vector<size_t>>, PHASE_COUNT> stages_;
     bool needsSort_ = false;
     World* world_ = nullptr;
+    std::vector<engine::job::JobHandle> stageJobs_;
+    bool profilingEnabled_ = true;
+    size_t profilerHistory_ = RunTimeHistory::DEFAULT_CAPACITY;
 };
 
 } // namespace engine::ECS
@@ -0,0 +1,69 @@
+// src/engine/core/ecs/SystemProfiler.cpp
+
+#include "SystemProfiler.hpp"
+#include <algorithm>
+#include <iomanip>
+
+namespace engine::ECS {
+
+void RunTimeHistory::SetCapacity(size_t capacity) {
+    samples_.assign(std::max<size_t>(capacity, 1), 0.0f);
+    Clear();
+}
+
+SystemTimingStats RunTimeHistory::ComputeStats(const std::string& name) const {
+    SystemTimingStats stats;
+    stats.name = name;
+    stats.samples = count_;
+    if (count_ == 0) {
+        return stats;
+    }
+
+    // Until the ring wraps, the valid samples are [0, count_)
+    std::vector<float> sorted(samples_.begin(), samples_.begin() + count_);
+    size_t lastIndex = (head_ + samples_.size() - 1) % samples_.size();
+    stats.lastMs = samples_[lastIndex];
+
+    double total = 0.0;
+    for (float sample : sorted) {
+        total += sample;
+    }
+    stats.avgMs = total / count_;
+
+    // Nearest-rank p95
+    size_t rank = (count_ * 95 + 99) / 100;
+    size_t p95Index = rank > 0 ? rank - 1 : 0;
+    std::nth_element(sorted.begin(), sorted.begin() + p95Index, sorted.end());
+    stats.p95Ms = sorted[p95Index];
+
+    auto [minIt, maxIt] = std::minmax_element(sorted.begin(), sorted.end());
+    stats.minMs = *minIt;
+    stats.maxMs = *maxIt;
+    return stats;
+}
+
+void WriteSystemTimingsCSV(std::ostream& out, const std::vector<SystemTimingStats>& stats) {
+    out << "system,samples,last_ms,min_ms,avg_ms,p95_ms,max_ms\n";
+    out << std::fixed << std::setprecision(4);
+    for (const auto& entry : stats) {
+        out << entry.name << ',' << entry.samples << ',' << entry.lastMs << ','
+            << entry.minMs << ',' << entry.avgMs << ',' << entry.p95Ms << ',' << entry.maxMs << '\n';
+    }
+}
+
+void WriteSystemTimingsJSON(std::ostream& out, const std::vector<SystemTimingStats>& stats) {
+    out << std::fixed << std::setprecision(4);
+    out << "{\n  \"systems\": [";
+    for (size_t i = 0; i < stats.size(); ++i) {
+        const auto& entry = stats[i];
+        // System names are plain identifiers, so no string escaping
+        out << (i == 0 ? "\n" : ",\n")
+            << "    {\"name\": \"" << entry.name << "\", \"samples\": " << entry.samples
+            << ", \"lastMs\": " << entry.lastMs << ", \"minMs\": " << entry.minMs
+            << ", \"avgMs\": " << entry.avgMs << ", \"p95Ms\": " << entry.p95Ms
+            << ", \"maxMs\": " << entry.maxMs << "}";
+    }
+    out << "\n  ]\n}\n";
+}
+
+} // namespace engine::ECS
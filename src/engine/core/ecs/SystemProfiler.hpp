@@ -0,0 +1,73 @@
+// src/engine/core/ecs/SystemProfiler.hpp
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <chrono>
+#include <ostream>
+#include <cstddef>
+
+// Per-system Update() timing in SystemManager. Build with
+// ENGINE_SYSTEM_PROFILING=0 (CMake: -DENGINE_SYSTEM_PROFILER=OFF) to compile
+// the timers out; the query API stays but reports nothing.
+#ifndef ENGINE_SYSTEM_PROFILING
+#define ENGINE_SYSTEM_PROFILING 1
+#endif
+
+namespace engine::ECS {
+
+// Summary of a system's recent Update() times, in milliseconds
+struct SystemTimingStats {
+    std::string name;
+    size_t samples = 0;
+    double lastMs = 0.0;
+    double minMs = 0.0;
+    double avgMs = 0.0;
+    double p95Ms = 0.0;
+    double maxMs = 0.0;
+};
+
+// Fixed-size ring of one system's last N Update() times, one sample per run.
+// Render-phase systems run once per frame; Fixed-phase systems run zero or
+// more times per frame, so their samples are per fixed step, not per frame.
+// Written only by the thread running that system, read between frames.
+class RunTimeHistory {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr size_t DEFAULT_CAPACITY = 240;
+
+    explicit RunTimeHistory(size_t capacity = DEFAULT_CAPACITY) { SetCapacity(capacity); }
+
+    // Drops existing samples
+    void SetCapacity(size_t capacity);
+    size_t GetCapacity() const { return samples_.size(); }
+    size_t GetCount() const { return count_; }
+
+    void Record(Clock::duration elapsed) {
+        samples_[head_] = std::chrono::duration<float, std::milli>(elapsed).count();
+        head_ = (head_ + 1) % samples_.size();
+        if (count_ < samples_.size()) {
+            count_++;
+        }
+    }
+
+    void Clear() {
+        head_ = 0;
+        count_ = 0;
+    }
+
+    SystemTimingStats ComputeStats(const std::string& name) const;
+
+private:
+    std::vector<float> samples_;
+    size_t head_ = 0;
+    size_t count_ = 0;
+};
+
+// Report writers used by SystemManager::DumpSystemTimings*
+void WriteSystemTimingsCSV(std::ostream& out, const std::vector<SystemTimingStats>& stats);
+void WriteSystemTimingsJSON(std::ostream& out, const std::vector<SystemTimingStats>& stats);
+
+} // namespace engine::ECS
@@ -0,0 +1,176 @@
+// src/engine/core/ecs/View.hpp
+
+#pragma once
+
+#include "ComponentStore.hpp"
+#include <tuple>
+#include <array>
+#include <utility>
+#include <type_traits>
+#include <cstddef>
+
+namespace engine::ECS {
+
+namespace detail {
+template<typename U, typename... Ts>
+constexpr size_t TypeIndex() {
+    constexpr bool matches[] = {std::is_same_v<U, Ts>...};
+    for (size_t i = 0; i < sizeof...(Ts); ++i) {
+        if (matches[i]) return i;
+    }
+    return sizeof...(Ts);
+}
+} // namespace detail
+
+// Non-owning, allocation-free view over every entity that has all of Ts.
+// Iteration is driven by the smallest store; the remaining stores are probed
+// in place. Entities are visited from the back of the driving store, so the
+// current entity may safely lose one of its components mid-iteration.
+//
+//   for (auto [id, transform, velocity] : componentManager.GetView<Transform2D, Velocity2D>()) { ... }
+//
+// Changed<U>(tick) narrows the view to entities whose U was stamped after
+// tick, typically the system's GetLastRunTick():
+//
+//   for (auto [id, health] : componentManager.GetView<HealthComponent>().Changed<HealthComponent>(GetLastRunTick())) { ... }
+template<typename... Ts>
+class View {
+    static_assert(sizeof...(Ts) > 0, "View needs at least one component type");
+
+public:
+    using Stores = std::tuple<ComponentStore<Ts>*...>;
+    using Components = std::tuple<Ts*...>;
+
+    class Iterator {
+    public:
+        using value_type = std::tuple<EntityID, Ts&...>;
+
+        Iterator(const std::vector<EntityID>* entities, size_t position, const View* view)
+            : entities_(entities), position_(position), view_(view) {
+            SkipInvalid();
+        }
+
+        // Components were fetched when the iterator landed on this entity
+        value_type operator*() const {
+            EntityID id = (*entities_)[position_ - 1];
+            return std::apply([id](auto*... components) {
+                return value_type(id, *components...);
+            }, components_);
+        }
+
+        Iterator& operator++() {
+            --position_;
+            SkipInvalid();
+            return *this;
+        }
+
+        bool operator==(const Iterator& other) const { return position_ == other.position_; }
+        bool operator!=(const Iterator& other) const { return position_ != other.position_; }
+
+    private:
+        void SkipInvalid() {
+            if (!entities_) {
+                position_ = 0;
+                return;
+            }
+            // Removals during iteration can shrink the driving store
+            if (position_ > entities_->size()) {
+                position_ = entities_->size();
+            }
+            while (position_ > 0 && !view_->Fetch((*entities_)[position_ - 1], components_)) {
+                --position_;
+            }
+        }
+
+        const std::vector<EntityID>* entities_;
+        size_t position_;
+        const View* view_;
+        Components components_{};
+    };
+
+    explicit View(ComponentStore<Ts>*... stores)
+        : stores_(stores...) {
+        // Any missing store means no entity can match
+        if ((!stores || ...)) {
+            return;
+        }
+        size_t smallest = std::numeric_limits<size_t>::max();
+        std::apply([this, &smallest](auto*... stores) {
+            ((stores->Size() < smallest
+                ? (smallest = stores->Size(), driver_ = &stores->Entities(), 0)
+                : 0), ...);
+        }, stores_);
+    }
+
+    // Copy of this view that only matches entities whose U changed after sinceTick
+    template<typename U>
+    View Changed(ChangeTick sinceTick) const {
+        constexpr size_t index = detail::TypeIndex<U, Ts...>();
+        static_assert(index < sizeof...(Ts), "Changed<U> needs U to be one of the view's components");
+        View filtered = *this;
+        filtered.changedSince_[index] = sinceTick;
+        filtered.filterMask_ |= 1u << index;
+        return filtered;
+    }
+
+    Iterator begin() const { return Iterator(driver_, driver_ ? driver_->size() : 0, this); }
+    Iterator end() const { return Iterator(nullptr, 0, this); }
+
+    // Calls fn(EntityID, Ts&...) for each matching entity
+    template<typename Fn>
+    void ForEach(Fn&& fn) const {
+        for (auto&& entry : *this) {
+            std::apply(fn, entry);
+        }
+    }
+
+    // Parallel version of ForEach: the driving store's dense range is split
+    // into chunks that run across the job system. fn may write the components
+    // it is given but must not add/remove components; use a CommandBuffer.
+    template<typename Fn>
+    void ParallelForEach(job::JobSystem& jobSystem, Fn&& fn, size_t chunkSize = DefaultChunkSize<Ts...>()) const {
+        if (!driver_) {
+            return;
+        }
+        const auto* entities = driver_;
+        jobSystem.ParallelFor(0, entities->size(), chunkSize, [this, entities, &fn](size_t begin, size_t end) {
+            Components components{};
+            for (size_t i = begin; i < end; ++i) {
+                EntityID id = (*entities)[i];
+                if (!Fetch(id, components)) {
+                    continue;
+                }
+                std::apply([&fn, id](auto*... fetched) { fn(id, *fetched...); }, components);
+            }
+        });
+    }
+
+    bool Empty() const { return begin() == end(); }
+
+    // Upper bound on the number of matches (size of the driving store)
+    size_t SizeHint() const { return driver_ ? driver_->size() : 0; }
+
+private:
+    // One sparse lookup per store: fills components and returns true if id
+    // has every component and passes the Changed<> filters
+    bool Fetch(EntityID id, Components& components) const {
+        return FetchImpl(id, components, std::index_sequence_for<Ts...>{});
+    }
+
+    template<size_t... Is>
+    bool FetchImpl(EntityID id, Components& components, std::index_sequence<Is...>) const {
+        if (!filterMask_) {
+            return ((std::get<Is>(components) = std::get<Is>(stores_)->Get(id)) && ...);
+        }
+        return ((std::get<Is>(components) = (filterMask_ & (1u << Is))
+                    ? std::get<Is>(stores_)->GetIfChangedSince(id, changedSince_[Is])
+                    : std::get<Is>(stores_)->Get(id)) && ...);
+    }
+
+    Stores stores_;
+    const std::vector<EntityID>* driver_ = nullptr;
+    std::array<ChangeTick, sizeof...(Ts)> changedSince_{};
+    uint32_t filterMask_ = 0;
+};
+
+} // namespace engine::ECS
@@ -3,10 +3,11 @@
 
 namespace engine::ECS {
 
-World::World(engine::event::EventManager* eventManager)
-    : eventManager_(eventManager) {
+World::World(engine::event::EventManager* eventManager, engine::job::JobSystem* jobSystem)
+    : eventManager_(eventManager), jobSystem_(jobSystem) {
     // Set World reference in SystemManager
     systemManager_.SetWorld(this);
+    commandBuffer_.SetWorld(this);
 }
 
 void World::Update(float deltaTime) {
@@ -15,7 +16,23 @@ void World::Update(float deltaTime) {
     }
 }
 
+void World::UpdatePhase(SystemPhase phase, float deltaTime) {
+    if (!IsPaused()) {
+        systemManager_.UpdatePhase(phase, deltaTime);
+    }
+}
+
+void World::DestroyEntity(EntityID id) {
+    if (!entityFactory_.IsValid(id)) {
+        return;
+    }
+    componentManager_.RemoveAllComponents(id);
+    entityFactory_.DestroyEntity(id);
+}
+
 void World::ClearAllEntities() {
+    commandBuffer_.Flush();
+    componentManager_.ClearAllComponents();
     entityFactory_.ClearAll();
 }
 
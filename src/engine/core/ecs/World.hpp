@@ -6,8 +6,10 @@
 #include "EntityFactory.hpp"
 #include "ComponentManager.hpp"
 #include "SystemManager.hpp"
+#include "CommandBuffer.hpp"
 #include "WorldState.hpp"
 #include "engine/core/event/EventManager.hpp"
+#include "engine/core/job/JobSystem.hpp"
 #include <vector>
 #include <memory>
 
@@ -15,20 +17,29 @@ namespace engine::ECS {
 
 class World {
 public:
-    World(engine::event::EventManager* eventManager = nullptr);
+    World(engine::event::EventManager* eventManager = nullptr,
+          engine::job::JobSystem* jobSystem = nullptr);
     ~World() = default;
 
     // ECS Integration
     EntityFactory& GetEntityFactory() { return entityFactory_; }
     ComponentManager& GetComponentManager() { return componentManager_; }
     SystemManager& GetSystemManager() { return systemManager_; }
+    // Shared buffer for code outside of systems; flushed around system updates
+    CommandBuffer& GetCommandBuffer() { return commandBuffer_; }
     
     // EventSystem
     engine::event::EventManager& GetEventManager() {
         return eventManager_ ? *eventManager_ : internalEventManager_;
     }
     
+    // JobSystem (engine-owned; a World created on its own runs jobs inline)
+    engine::job::JobSystem& GetJobSystem() {
+        return jobSystem_ ? *jobSystem_ : internalJobSystem_;
+    }
+    
     // Entity management
+    void DestroyEntity(EntityID id);   // Immediate: removes components, then frees the ID
     void ClearAllEntities();
     size_t GetEntityCount() const;
     bool HasEntity(EntityID id) const;
@@ -39,14 +50,18 @@ public:
     bool IsPaused() const { return worldState_.IsPaused(); }
 
     void Update(float deltaTime);
+    void UpdatePhase(SystemPhase phase, float deltaTime);
 
 private:
     EntityFactory entityFactory_;
     ComponentManager componentManager_;
     SystemManager systemManager_;
+    CommandBuffer commandBuffer_;
     WorldState worldState_;
     engine::event::EventManager* eventManager_;
     engine::event::EventManager internalEventManager_;  //backup internal eventManager
+    engine::job::JobSystem* jobSystem_;
+    engine::job::JobSystem internalJobSystem_;          //single-threaded fallback
 };
 
 } // namespace engine::ECS
@@ -3,8 +3,10 @@
 #pragma once
 
 #include "engine/core/Types.hpp"
+#include "engine/core/ecs/particles/ParticlePool.hpp"
+#include "engine/resource/TextureHandle.hpp"
 #include <SDL3/SDL.h>
-#include <random>
+#include <string>
 
 namespace engine::ECS {
 
@@ -20,8 +22,8 @@ struct ParticleEmitterComponent {
     float emissionRate = 10.0f;         // Particles per second
     float emissionAccumulator = 0.0f;   // Time accumulator for emission
     
-    int maxParticles = 100;             // Maximum particles this emitter can have
-    int activeParticles = 0;            // Current active particle count
+    int maxParticles = 100;             // Maximum particles this emitter can have (pool capacity)
+    int activeParticles = 0;            // Current active particle count (mirrors particles.Size())
     
     // Particle initial properties
     float particleLifetime = 1.0f;      // Lifetime of each particle
@@ -58,8 +60,16 @@ struct ParticleEmitterComponent {
     std::string particleTexture = "pixel.png";  // Default to pixel texture
     
     // One-shot vs continuous
-    bool isOneShot = false;             // If true, emit all particles at once
+    bool isOneShot = false;             // If true, emit all particles at once; the emitter
+                                        // entity is destroyed once they have all died
     int burstCount = 50;                // Number of particles for one-shot
+    
+    int renderLayer = 15;               // Above entities, below UI
+    
+    // Live particles in world space, drawn by RenderSystem as one batch.
+    // Sized to maxParticles on first emission.
+    ParticlePool particles;
+    resources::TextureHandle texture;   // Resolved from particleTexture when drawn
 };
 
 } // namespace engine::ECS
\ No newline at end of file
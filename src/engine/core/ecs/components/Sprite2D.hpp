@@ -1,6 +1,7 @@
 // src/engine/core/ecs/components/Sprite2D.hpp
 
 #pragma once
+#include "engine/resource/TextureHandle.hpp"
 #include <SDL3/SDL.h>
 #include <string>
 
@@ -17,6 +18,11 @@ struct Sprite2D {
     // Default {-1, -1} means use sprite center
     // {0, 0} = top-left, {0.5, 0.5} = center, {1, 1} = bottom-right
     SDL_FPoint pivotOffset = {-1.0f, -1.0f};
+
+    // Resolved from texturePath on first draw; reset it (or set it from
+    // ResourceManager::LoadTextureHandle) whenever texturePath changes.
+    // Last, so positional initializers of the fields above keep working.
+    resources::TextureHandle texture;
 };
 
 } // namespace engine::ECS
\ No newline at end of file
@@ -0,0 +1,260 @@
+// src/engine/core/ecs/particles/ParticleKernels.cpp
+
+#include "ParticleKernels.hpp"
+#include <algorithm>
+#include <bit>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define ENGINE_PARTICLE_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#else
+#define ENGINE_PARTICLE_X86 0
+#endif
+
+// GCC/Clang only emit AVX2 code inside functions that ask for it, so the
+// rest of the engine keeps its baseline flags; MSVC allows it anywhere
+#if ENGINE_PARTICLE_X86 && (defined(__GNUC__) || defined(__clang__))
+#define ENGINE_TARGET_SSE2 __attribute__((target("sse2")))
+#define ENGINE_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define ENGINE_TARGET_SSE2
+#define ENGINE_TARGET_AVX2
+#endif
+
+namespace engine::ECS {
+
+namespace {
+
+// Scalar versions over [begin, end); also finish the tails of the SIMD ones
+
+void IntegrateRange(const ParticleKernelArgs& args, size_t begin, size_t end) {
+    const float dt = args.deltaTime;
+    const float dvx = args.accelerationX * dt;
+    const float dvy = args.accelerationY * dt;
+    for (size_t i = begin; i < end; ++i) {
+        args.previousX[i] = args.x[i];
+        args.previousY[i] = args.y[i];
+        args.vx[i] += dvx;
+        args.vy[i] += dvy;
+        args.x[i] += args.vx[i] * dt;
+        args.y[i] += args.vy[i] * dt;
+        args.rotation[i] += args.rotationSpeed[i] * dt;
+        args.age[i] += dt;
+    }
+}
+
+size_t FadeRange(const ParticleKernelArgs& args, size_t begin, size_t end) {
+    float start[4], delta[4];
+    for (int c = 0; c < 4; ++c) {
+        start[c] = args.startColor[c];
+        delta[c] = args.endColor[c] - args.startColor[c];
+    }
+    size_t dead = 0;
+    for (size_t i = begin; i < end; ++i) {
+        float progress = args.age[i] * args.inverseLifetime[i];
+        dead += progress >= 1.0f;
+        float t = std::min(progress, 1.0f);
+        args.size[i] = args.startSize[i] + (args.endSize[i] - args.startSize[i]) * t;
+        args.r[i] = start[0] + delta[0] * t;
+        args.g[i] = start[1] + delta[1] * t;
+        args.b[i] = start[2] + delta[2] * t;
+        args.a[i] = start[3] + delta[3] * t;
+    }
+    return dead;
+}
+
+void IntegrateScalar(const ParticleKernelArgs& args) {
+    IntegrateRange(args, 0, args.count);
+}
+
+size_t FadeScalar(const ParticleKernelArgs& args) {
+    return FadeRange(args, 0, args.count);
+}
+
+#if ENGINE_PARTICLE_X86
+
+ENGINE_TARGET_SSE2 void IntegrateSSE2(const ParticleKernelArgs& args) {
+    const size_t vectorEnd = args.count & ~size_t(3);
+    const __m128 dt = _mm_set1_ps(args.deltaTime);
+    const __m128 dvx = _mm_set1_ps(args.accelerationX * args.deltaTime);
+    const __m128 dvy = _mm_set1_ps(args.accelerationY * args.deltaTime);
+    for (size_t i = 0; i < vectorEnd; i += 4) {
+        __m128 x = _mm_loadu_ps(args.x + i);
+        __m128 y = _mm_loadu_ps(args.y + i);
+        _mm_storeu_ps(args.previousX + i, x);
+        _mm_storeu_ps(args.previousY + i, y);
+        __m128 vx = _mm_add_ps(_mm_loadu_ps(args.vx + i), dvx);
+        __m128 vy = _mm_add_ps(_mm_loadu_ps(args.vy + i), dvy);
+        _mm_storeu_ps(args.vx + i, vx);
+        _mm_storeu_ps(args.vy + i, vy);
+        _mm_storeu_ps(args.x + i, _mm_add_ps(x, _mm_mul_ps(vx, dt)));
+        _mm_storeu_ps(args.y + i, _mm_add_ps(y, _mm_mul_ps(vy, dt)));
+        __m128 rotation = _mm_loadu_ps(args.rotation + i);
+        __m128 rotationSpeed = _mm_loadu_ps(args.rotationSpeed + i);
+        _mm_storeu_ps(args.rotation + i, _mm_add_ps(rotation, _mm_mul_ps(rotationSpeed, dt)));
+        _mm_storeu_ps(args.age + i, _mm_add_ps(_mm_loadu_ps(args.age + i), dt));
+    }
+    IntegrateRange(args, vectorEnd, args.count);
+}
+
+ENGINE_TARGET_SSE2 size_t FadeSSE2(const ParticleKernelArgs& args) {
+    const size_t vectorEnd = args.count & ~size_t(3);
+    const __m128 one = _mm_set1_ps(1.0f);
+    __m128 start[4], delta[4];
+    for (int c = 0; c < 4; ++c) {
+        start[c] = _mm_set1_ps(args.startColor[c]);
+        delta[c] = _mm_set1_ps(args.endColor[c] - args.startColor[c]);
+    }
+    float* channels[4] = {args.r, args.g, args.b, args.a};
+    size_t dead = 0;
+    for (size_t i = 0; i < vectorEnd; i += 4) {
+        __m128 progress = _mm_mul_ps(_mm_loadu_ps(args.age + i), _mm_loadu_ps(args.inverseLifetime + i));
+        dead += static_cast<size_t>(std::popcount(static_cast<unsigned>(_mm_movemask_ps(_mm_cmpge_ps(progress, one)))));
+        __m128 t = _mm_min_ps(progress, one);
+        __m128 startSize = _mm_loadu_ps(args.startSize + i);
+        __m128 endSize = _mm_loadu_ps(args.endSize + i);
+        _mm_storeu_ps(args.size + i, _mm_add_ps(startSize, _mm_mul_ps(_mm_sub_ps(endSize, startSize), t)));
+        for (int c = 0; c < 4; ++c) {
+            _mm_storeu_ps(channels[c] + i, _mm_add_ps(start[c], _mm_mul_ps(delta[c], t)));
+        }
+    }
+    return dead + FadeRange(args, vectorEnd, args.count);
+}
+
+ENGINE_TARGET_AVX2 void IntegrateAVX2(const ParticleKernelArgs& args) {
+    const size_t vectorEnd = args.count & ~size_t(7);
+    const __m256 dt = _mm256_set1_ps(args.deltaTime);
+    const __m256 dvx = _mm256_set1_ps(args.accelerationX * args.deltaTime);
+    const __m256 dvy = _mm256_set1_ps(args.accelerationY * args.deltaTime);
+    for (size_t i = 0; i < vectorEnd; i += 8) {
+        __m256 x = _mm256_loadu_ps(args.x + i);
+        __m256 y = _mm256_loadu_ps(args.y + i);
+        _mm256_storeu_ps(args.previousX + i, x);
+        _mm256_storeu_ps(args.previousY + i, y);
+        __m256 vx = _mm256_add_ps(_mm256_loadu_ps(args.vx + i), dvx);
+        __m256 vy = _mm256_add_ps(_mm256_loadu_ps(args.vy + i), dvy);
+        _mm256_storeu_ps(args.vx + i, vx);
+        _mm256_storeu_ps(args.vy + i, vy);
+        _mm256_storeu_ps(args.x + i, _mm256_add_ps(x, _mm256_mul_ps(vx, dt)));
+        _mm256_storeu_ps(args.y + i, _mm256_add_ps(y, _mm256_mul_ps(vy, dt)));
+        __m256 rotation = _mm256_loadu_ps(args.rotation + i);
+        __m256 rotationSpeed = _mm256_loadu_ps(args.rotationSpeed + i);
+        _mm256_storeu_ps(args.rotation + i, _mm256_add_ps(rotation, _mm256_mul_ps(rotationSpeed, dt)));
+        _mm256_storeu_ps(args.age + i, _mm256_add_ps(_mm256_loadu_ps(args.age + i), dt));
+    }
+    IntegrateRange(args, vectorEnd, args.count);
+}
+
+ENGINE_TARGET_AVX2 size_t FadeAVX2(const ParticleKernelArgs& args) {
+    const size_t vectorEnd = args.count & ~size_t(7);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    __m256 start[4], delta[4];
+    for (int c = 0; c < 4; ++c) {
+        start[c] = _mm256_set1_ps(args.startColor[c]);
+        delta[c] = _mm256_set1_ps(args.endColor[c] - args.startColor[c]);
+    }
+    float* channels[4] = {args.r, args.g, args.b, args.a};
+    size_t dead = 0;
+    for (size_t i = 0; i < vectorEnd; i += 8) {
+        __m256 progress = _mm256_mul_ps(_mm256_loadu_ps(args.age + i), _mm256_loadu_ps(args.inverseLifetime + i));
+        __m256 expired = _mm256_cmp_ps(progress, one, _CMP_GE_OQ);
+        dead += static_cast<size_t>(std::popcount(static_cast<unsigned>(_mm256_movemask_ps(expired))));
+        __m256 t = _mm256_min_ps(progress, one);
+        __m256 startSize = _mm256_loadu_ps(args.startSize + i);
+        __m256 endSize = _mm256_loadu_ps(args.endSize + i);
+        _mm256_storeu_ps(args.size + i, _mm256_add_ps(startSize, _mm256_mul_ps(_mm256_sub_ps(endSize, startSize), t)));
+        for (int c = 0; c < 4; ++c) {
+            _mm256_storeu_ps(channels[c] + i, _mm256_add_ps(start[c], _mm256_mul_ps(delta[c], t)));
+        }
+    }
+    return dead + FadeRange(args, vectorEnd, args.count);
+}
+
+void Cpuid(unsigned leaf, unsigned subleaf, unsigned registers[4]) {
+#if defined(_MSC_VER)
+    int values[4];
+    __cpuidex(values, static_cast<int>(leaf), static_cast<int>(subleaf));
+    for (int i = 0; i < 4; ++i) registers[i] = static_cast<unsigned>(values[i]);
+#else
+    if (!__get_cpuid_count(leaf, subleaf, &registers[0], &registers[1], &registers[2], &registers[3])) {
+        registers[0] = registers[1] = registers[2] = registers[3] = 0;
+    }
+#endif
+}
+
+// XCR0: which register state the OS saves on context switch
+#if !defined(_MSC_VER)
+__attribute__((target("xsave")))
+#endif
+unsigned long long ReadXcr0() {
+    return _xgetbv(0);
+}
+
+#endif // ENGINE_PARTICLE_X86
+
+const ParticleKernels SCALAR_KERNELS = {SimdLevel::Scalar, "scalar", IntegrateScalar, FadeScalar};
+#if ENGINE_PARTICLE_X86
+const ParticleKernels SSE2_KERNELS = {SimdLevel::SSE2, "SSE2", IntegrateSSE2, FadeSSE2};
+const ParticleKernels AVX2_KERNELS = {SimdLevel::AVX2, "AVX2", IntegrateAVX2, FadeAVX2};
+#endif
+
+} // namespace
+
+SimdLevel DetectSimdLevel() {
+#if ENGINE_PARTICLE_X86
+    unsigned leaf0[4], leaf1[4], leaf7[4] = {0, 0, 0, 0};
+    Cpuid(0, 0, leaf0);
+    unsigned maxLeaf = leaf0[0];
+    if (maxLeaf < 1) {
+        return SimdLevel::Scalar;
+    }
+    Cpuid(1, 0, leaf1);
+    if (maxLeaf >= 7) {
+        Cpuid(7, 0, leaf7);
+    }
+
+    const bool sse2 = (leaf1[3] >> 26) & 1;        // EDX bit 26
+    const bool osxsave = (leaf1[2] >> 27) & 1;     // ECX bit 27
+    const bool avx = (leaf1[2] >> 28) & 1;         // ECX bit 28
+    const bool avx2 = (leaf7[1] >> 5) & 1;         // Leaf 7 EBX bit 5
+    // The OS must also save XMM and YMM state (XCR0 bits 1 and 2)
+    const bool osAvx = osxsave && (ReadXcr0() & 0x6) == 0x6;
+
+    if (avx && avx2 && osAvx) {
+        return SimdLevel::AVX2;
+    }
+    if (sse2) {
+        return SimdLevel::SSE2;
+    }
+#endif
+    return SimdLevel::Scalar;
+}
+
+const ParticleKernels& GetParticleKernels() {
+    static const ParticleKernels& kernels = GetParticleKernels(DetectSimdLevel());
+    return kernels;
+}
+
+const ParticleKernels& GetParticleKernels(SimdLevel level) {
+#if ENGINE_PARTICLE_X86
+    static const SimdLevel supported = DetectSimdLevel();
+    if (level > supported) {
+        level = supported;
+    }
+    switch (level) {
+        case SimdLevel::AVX2: return AVX2_KERNELS;
+        case SimdLevel::SSE2: return SSE2_KERNELS;
+        case SimdLevel::Scalar: break;
+    }
+#else
+    (void)level;
+#endif
+    return SCALAR_KERNELS;
+}
+
+} // namespace engine::ECS
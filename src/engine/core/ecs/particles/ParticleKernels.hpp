@@ -0,0 +1,65 @@
+// src/engine/core/ecs/particles/ParticleKernels.hpp
+
+#pragma once
+
+#include <cstddef>
+
+namespace engine::ECS {
+
+// Per-particle math of ParticlePool::Update() over its arrays, in scalar,
+// SSE2 (4 lanes) and AVX2 (8 lanes) variants. No FMA, so every variant
+// rounds exactly like the scalar one and results don't depend on the CPU.
+struct ParticleKernelArgs {
+    size_t count = 0;
+    float* x = nullptr;
+    float* y = nullptr;
+    float* previousX = nullptr;
+    float* previousY = nullptr;
+    float* vx = nullptr;
+    float* vy = nullptr;
+    float* rotation = nullptr;
+    const float* rotationSpeed = nullptr;
+    float* age = nullptr;
+    const float* inverseLifetime = nullptr;
+    const float* startSize = nullptr;
+    const float* endSize = nullptr;
+    float* size = nullptr;
+    float* r = nullptr;
+    float* g = nullptr;
+    float* b = nullptr;
+    float* a = nullptr;
+
+    float deltaTime = 0.0f;
+    float accelerationX = 0.0f;
+    float accelerationY = 0.0f;
+    float startColor[4] = {1.0f, 1.0f, 1.0f, 1.0f};  // RGBA, 0..1
+    float endColor[4] = {1.0f, 1.0f, 1.0f, 0.0f};
+};
+
+enum class SimdLevel {
+    Scalar,
+    SSE2,
+    AVX2
+};
+
+struct ParticleKernels {
+    SimdLevel level;
+    const char* name;
+    // Saves previous positions, then ages, accelerates, moves and rotates
+    void (*integrate)(const ParticleKernelArgs& args);
+    // Size and color from life progress (clamped to 1); returns how many
+    // particles have reached the end of their lifetime
+    size_t (*fade)(const ParticleKernelArgs& args);
+};
+
+// Best level this CPU and OS support (CPUID, plus XGETBV for AVX state)
+SimdLevel DetectSimdLevel();
+
+// Kernels for DetectSimdLevel(), chosen once on first use
+const ParticleKernels& GetParticleKernels();
+
+// Kernels for a specific level, falling back to the best supported one
+// below it (e.g. for benchmarks)
+const ParticleKernels& GetParticleKernels(SimdLevel level);
+
+} // namespace engine::ECS
@@ -0,0 +1,123 @@
+// src/engine/core/ecs/particles/ParticlePool.cpp
+
+#include "ParticlePool.hpp"
+#include "ParticleKernels.hpp"
+#include <algorithm>
+
+namespace engine::ECS {
+
+namespace {
+
+constexpr float MIN_LIFETIME = 0.001f;
+
+} // namespace
+
+std::array<std::vector<float>*, ParticlePool::FIELD_COUNT> ParticlePool::Fields() {
+    return {&data_.x, &data_.y, &data_.previousX, &data_.previousY,
+            &data_.vx, &data_.vy, &data_.age, &data_.inverseLifetime,
+            &data_.startSize, &data_.endSize, &data_.size,
+            &data_.rotation, &data_.rotationSpeed,
+            &data_.r, &data_.g, &data_.b, &data_.a};
+}
+
+void ParticlePool::SetCapacity(size_t capacity) {
+    for (auto* field : Fields()) {
+        field->assign(capacity, 0.0f);
+    }
+    survivors_.assign(capacity, 0);
+    capacity_ = capacity;
+    count_ = 0;
+}
+
+bool ParticlePool::Spawn(const ParticleSpawn& spawn, SDL_Color color) {
+    if (count_ >= capacity_) {
+        return false;
+    }
+    size_t i = count_++;
+    data_.x[i] = data_.previousX[i] = spawn.x;
+    data_.y[i] = data_.previousY[i] = spawn.y;
+    data_.vx[i] = spawn.vx;
+    data_.vy[i] = spawn.vy;
+    data_.age[i] = 0.0f;
+    data_.inverseLifetime[i] = 1.0f / std::max(spawn.lifetime, MIN_LIFETIME);
+    data_.startSize[i] = data_.size[i] = spawn.startSize;
+    data_.endSize[i] = spawn.endSize;
+    data_.rotation[i] = 0.0f;
+    data_.rotationSpeed[i] = spawn.rotationSpeed;
+    data_.r[i] = color.r / 255.0f;
+    data_.g[i] = color.g / 255.0f;
+    data_.b[i] = color.b / 255.0f;
+    data_.a[i] = color.a / 255.0f;
+    return true;
+}
+
+void ParticlePool::Update(float deltaTime, float accelerationX, float accelerationY,
+                          SDL_Color startColor, SDL_Color endColor) {
+    if (count_ == 0) {
+        return;
+    }
+
+    ParticleKernelArgs args;
+    args.count = count_;
+    args.x = data_.x.data();
+    args.y = data_.y.data();
+    args.previousX = data_.previousX.data();
+    args.previousY = data_.previousY.data();
+    args.vx = data_.vx.data();
+    args.vy = data_.vy.data();
+    args.rotation = data_.rotation.data();
+    args.rotationSpeed = data_.rotationSpeed.data();
+    args.age = data_.age.data();
+    args.inverseLifetime = data_.inverseLifetime.data();
+    args.startSize = data_.startSize.data();
+    args.endSize = data_.endSize.data();
+    args.size = data_.size.data();
+    args.r = data_.r.data();
+    args.g = data_.g.data();
+    args.b = data_.b.data();
+    args.a = data_.a.data();
+    args.deltaTime = deltaTime;
+    args.accelerationX = accelerationX;
+    args.accelerationY = accelerationY;
+    const SDL_Color colors[2] = {startColor, endColor};
+    float* targets[2] = {args.startColor, args.endColor};
+    for (int k = 0; k < 2; ++k) {
+        targets[k][0] = colors[k].r / 255.0f;
+        targets[k][1] = colors[k].g / 255.0f;
+        targets[k][2] = colors[k].b / 255.0f;
+        targets[k][3] = colors[k].a / 255.0f;
+    }
+
+    // Integrate (semi-implicit Euler), then size and color over life
+    const ParticleKernels& kernels = GetParticleKernels();
+    kernels.integrate(args);
+    size_t dead = kernels.fade(args);
+
+    if (dead > 0) {
+        Compact();
+    }
+}
+
+void ParticlePool::Compact() {
+    const float* age = data_.age.data();
+    const float* inverseLifetime = data_.inverseLifetime.data();
+    uint32_t* survivors = survivors_.data();
+
+    // Survivor indices without branching, in order, so draw order is stable
+    size_t survivorCount = 0;
+    for (size_t i = 0; i < count_; ++i) {
+        survivors[survivorCount] = static_cast<uint32_t>(i);
+        survivorCount += age[i] * inverseLifetime[i] < 1.0f;
+    }
+
+    // Then one streaming gather per field; survivors[k] >= k, so in place is safe
+    for (auto* field : Fields()) {
+        float* values = field->data();
+        for (size_t k = 0; k < survivorCount; ++k) {
+            values[k] = values[survivors[k]];
+        }
+    }
+    count_ = survivorCount;
+}
+
+} // namespace engine::ECS
@@ -0,0 +1,78 @@
+// src/engine/core/ecs/particles/ParticlePool.hpp
+
+#pragma once
+
+#include <SDL3/SDL.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace engine::ECS {
+
+// Initial state of one particle
+struct ParticleSpawn {
+    float x = 0.0f;
+    float y = 0.0f;
+    float vx = 0.0f;
+    float vy = 0.0f;
+    float lifetime = 1.0f;
+    float startSize = 1.0f;
+    float endSize = 0.0f;
+    float rotationSpeed = 0.0f;
+};
+
+// Fixed-capacity particle storage in structure-of-arrays form: one packed
+// float array per field, live particles in [0, Size()). Arrays are sized
+// once by SetCapacity(), so spawning and dying never allocate. Update()
+// runs the SIMD kernels picked for this CPU (ParticleKernels.hpp) over the
+// arrays and then compacts the dead out, keeping survivors in spawn order.
+class ParticlePool {
+public:
+    struct Data {
+        std::vector<float> x, y;
+        std::vector<float> previousX, previousY;  // Before the last Update()
+        std::vector<float> vx, vy;
+        std::vector<float> age, inverseLifetime;
+        std::vector<float> startSize, endSize, size;
+        std::vector<float> rotation, rotationSpeed;
+        std::vector<float> r, g, b, a;            // Current color, 0..1
+    };
+
+    ParticlePool() = default;
+    explicit ParticlePool(size_t capacity) { SetCapacity(capacity); }
+
+    // Reallocates the arrays and drops every live particle
+    void SetCapacity(size_t capacity);
+    size_t GetCapacity() const { return capacity_; }
+
+    // False (and nothing spawned) when the pool is full
+    bool Spawn(const ParticleSpawn& spawn, SDL_Color color);
+
+    // Ages, accelerates, moves and fades every particle by deltaTime, then
+    // removes those past their lifetime. Colors fade from startColor to
+    // endColor and size from startSize to endSize over each lifetime.
+    void Update(float deltaTime, float accelerationX, float accelerationY,
+                SDL_Color startColor, SDL_Color endColor);
+
+    void Clear() { count_ = 0; }
+
+    size_t Size() const { return count_; }
+    bool Empty() const { return count_ == 0; }
+    bool Full() const { return count_ >= capacity_; }
+
+    // Arrays hold GetCapacity() entries; only the first Size() are live
+    const Data& GetData() const { return data_; }
+
+private:
+    static constexpr size_t FIELD_COUNT = 17;
+    std::array<std::vector<float>*, FIELD_COUNT> Fields();
+    void Compact();
+
+    Data data_;
+    std::vector<uint32_t> survivors_;  // Compaction scratch, capacity-sized
+    size_t capacity_ = 0;
+    size_t count_ = 0;
+};
+
+} // namespace engine::ECS
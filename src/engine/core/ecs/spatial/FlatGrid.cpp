@@ -0,0 +1,268 @@
+// src/engine/core/ecs/spatial/FlatGrid.cpp
+
+#include "FlatGrid.hpp"
+#include "engine/core/ecs/EntityHandle.hpp"
+#include "engine/core/log/Logger.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace engine::ECS {
+
+FlatGrid::FlatGrid(float cellSize, const SDL_FRect& worldBounds)
+    : cellSize_(cellSize), worldBounds_(worldBounds) {
+
+    if (cellSize_ <= 0.0f) {
+        LOG_WARN("FlatGrid") << "cellSize must be positive, using default " << DEFAULT_CELL_SIZE;
+        cellSize_ = DEFAULT_CELL_SIZE;
+    }
+
+    auto cellsAlong = [this](float extent) {
+        return std::max(1, static_cast<int>(std::ceil(extent / cellSize_)));
+    };
+    gridWidth_ = cellsAlong(worldBounds_.w);
+    gridHeight_ = cellsAlong(worldBounds_.h);
+
+    size_t totalCells = GetTotalCells();
+    if (totalCells > MAX_GRID_CELLS) {
+        LOG_ERROR("FlatGrid") << "Grid would have " << totalCells
+                              << " cells, exceeding maximum of " << MAX_GRID_CELLS;
+        float minCellSize = std::sqrt((worldBounds_.w * worldBounds_.h) / MAX_GRID_CELLS);
+        cellSize_ = std::max(minCellSize * 1.1f, MIN_CELL_SIZE);
+        gridWidth_ = cellsAlong(worldBounds_.w);
+        gridHeight_ = cellsAlong(worldBounds_.h);
+    }
+    inverseCellSize_ = 1.0f / cellSize_;
+}
+
+void FlatGrid::Insert(EntityID entity, const SDL_FRect& bounds) {
+    if (FindSlot(entity) != NOT_STORED) {
+        Update(entity, bounds);
+        return;
+    }
+
+    uint32_t index = GetEntityIndex(entity);
+    if (index >= slots_.size()) {
+        slots_.resize(index + 1, NOT_STORED);
+    }
+    if (slots_[index] != NOT_STORED) {
+        Remove(entities_[slots_[index]]);  // Older entity that had this index
+    }
+    slots_[index] = static_cast<uint32_t>(entities_.size());
+
+    entities_.push_back(entity);
+    minX_.push_back(bounds.x);
+    minY_.push_back(bounds.y);
+    maxX_.push_back(bounds.x + bounds.w);
+    maxY_.push_back(bounds.y + bounds.h);
+    dirty_ = true;
+}
+
+void FlatGrid::Update(EntityID entity, const SDL_FRect& bounds) {
+    uint32_t slot = FindSlot(entity);
+    if (slot == NOT_STORED) {
+        Insert(entity, bounds);
+        return;
+    }
+
+    float maxX = bounds.x + bounds.w;
+    float maxY = bounds.y + bounds.h;
+    if (minX_[slot] == bounds.x && minY_[slot] == bounds.y &&
+        maxX_[slot] == maxX && maxY_[slot] == maxY) {
+        return;
+    }
+    minX_[slot] = bounds.x;
+    minY_[slot] = bounds.y;
+    maxX_[slot] = maxX;
+    maxY_[slot] = maxY;
+    dirty_ = true;
+}
+
+void FlatGrid::Remove(EntityID entity) {
+    uint32_t slot = FindSlot(entity);
+    if (slot == NOT_STORED) {
+        return;
+    }
+
+    // Swap the last entity into the hole
+    uint32_t last = static_cast<uint32_t>(entities_.size() - 1);
+    if (slot != last) {
+        entities_[slot] = entities_[last];
+        minX_[slot] = minX_[last];
+        minY_[slot] = minY_[last];
+        maxX_[slot] = maxX_[last];
+        maxY_[slot] = maxY_[last];
+        slots_[GetEntityIndex(entities_[slot])] = slot;
+    }
+    entities_.pop_back();
+    minX_.pop_back();
+    minY_.pop_back();
+    maxX_.pop_back();
+    maxY_.pop_back();
+    slots_[GetEntityIndex(entity)] = NOT_STORED;
+    dirty_ = true;
+}
+
+void FlatGrid::Clear() {
+    for (EntityID entity : entities_) {
+        slots_[GetEntityIndex(entity)] = NOT_STORED;
+    }
+    entities_.clear();
+    minX_.clear();
+    minY_.clear();
+    maxX_.clear();
+    maxY_.clear();
+    dirty_ = true;
+}
+
+void FlatGrid::Rebuild() const {
+    if (!dirty_) {
+        return;
+    }
+    dirty_ = false;
+
+    const size_t entityCount = entities_.size();
+    const size_t cellCount = GetTotalCells();
+
+    // Pass 1: pick each entity's cell and count per cell, shifted by one so
+    // the prefix sum leaves each cell's start in cellStart_[c]
+    cellStart_.assign(cellCount + 1, 0);
+    cellOf_.resize(entityCount);
+    oversized_.clear();
+    float maxHalfExtent = 0.0f;
+    for (size_t i = 0; i < entityCount; ++i) {
+        float width = maxX_[i] - minX_[i];
+        float height = maxY_[i] - minY_[i];
+        if (width > cellSize_ || height > cellSize_) {
+            cellOf_[i] = OVERSIZED;
+            oversized_.push_back(static_cast<uint32_t>(i));
+            continue;
+        }
+        maxHalfExtent = std::max(maxHalfExtent, std::max(width, height) * 0.5f);
+
+        uint32_t cell = static_cast<uint32_t>(CellY(minY_[i] + height * 0.5f)) * gridWidth_ +
+                        static_cast<uint32_t>(CellX(minX_[i] + width * 0.5f));
+        cellOf_[i] = cell;
+        cellStart_[cell + 1]++;
+    }
+    // Padded so rounding in the center math can't drop a touching neighbour
+    maxHalfExtent_ = maxHalfExtent + cellSize_ * 0.001f;
+    for (size_t c = 0; c < cellCount; ++c) {
+        cellStart_[c + 1] += cellStart_[c];
+    }
+
+    // Pass 2: scatter entities and their bounds into cell order
+    const size_t entryCount = cellStart_[cellCount];
+    cellEntities_.resize(entryCount);
+    cellMinX_.resize(entryCount);
+    cellMinY_.resize(entryCount);
+    cellMaxX_.resize(entryCount);
+    cellMaxY_.resize(entryCount);
+    cursors_.assign(cellStart_.begin(), cellStart_.end() - 1);
+    for (size_t i = 0; i < entityCount; ++i) {
+        if (cellOf_[i] == OVERSIZED) continue;
+
+        uint32_t entry = cursors_[cellOf_[i]]++;
+        cellEntities_[entry] = entities_[i];
+        cellMinX_[entry] = minX_[i];
+        cellMinY_[entry] = minY_[i];
+        cellMaxX_[entry] = maxX_[i];
+        cellMaxY_[entry] = maxY_[i];
+    }
+}
+
+std::vector<EntityID> FlatGrid::Query(const SDL_FRect& area) const {
+    std::vector<EntityID> result;
+    Query(area, result);
+    return result;
+}
+
+void FlatGrid::Query(const SDL_FRect& area, std::vector<EntityID>& out) const {
+    Rebuild();
+
+    const float queryMinX = area.x;
+    const float queryMinY = area.y;
+    const float queryMaxX = area.x + area.w;
+    const float queryMaxY = area.y + area.h;
+
+    // Any overlapping entity has its center within maxHalfExtent_ of the area
+    CellRange range = GetCellRange(queryMinX - maxHalfExtent_, queryMinY - maxHalfExtent_,
+                                   queryMaxX + maxHalfExtent_, queryMaxY + maxHalfExtent_);
+
+    size_t scanned = oversized_.size();
+    for (int y = range.minY; y <= range.maxY; ++y) {
+        // Cells of one row are contiguous, and so are their entries
+        size_t rowStart = static_cast<size_t>(y) * gridWidth_;
+        uint32_t begin = cellStart_[rowStart + range.minX];
+        uint32_t end = cellStart_[rowStart + range.maxX + 1];
+        scanned += end - begin;
+
+        for (uint32_t entry = begin; entry < end; ++entry) {
+            // Touching counts as overlapping, same as SimpleGrid
+            if (cellMinX_[entry] <= queryMaxX && cellMaxX_[entry] >= queryMinX &&
+                cellMinY_[entry] <= queryMaxY && cellMaxY_[entry] >= queryMinY) {
+                out.push_back(cellEntities_[entry]);
+            }
+        }
+    }
+
+    for (uint32_t slot : oversized_) {
+        if (minX_[slot] <= queryMaxX && maxX_[slot] >= queryMinX &&
+            minY_[slot] <= queryMaxY && maxY_[slot] >= queryMinY) {
+            out.push_back(entities_[slot]);
+        }
+    }
+    lastQueryCount_.store(scanned, std::memory_order_relaxed);
+}
+
+std::vector<EntityID> FlatGrid::GetNearbyEntities(EntityID entity, float radius) const {
+    uint32_t slot = FindSlot(entity);
+    if (slot == NOT_STORED) {
+        return {};
+    }
+
+    SDL_FRect bounds = {minX_[slot], minY_[slot], maxX_[slot] - minX_[slot], maxY_[slot] - minY_[slot]};
+    float centerX = bounds.x + bounds.w * 0.5f;
+    float centerY = bounds.y + bounds.h * 0.5f;
+    SDL_FRect queryArea = {centerX - radius, centerY - radius, radius * 2.0f, radius * 2.0f};
+
+    std::vector<EntityID> result;
+    for (EntityID candidate : Query(queryArea)) {
+        if (candidate == entity) continue;
+
+        uint32_t other = FindSlot(candidate);
+        SDL_FRect otherBounds = {minX_[other], minY_[other], maxX_[other] - minX_[other], maxY_[other] - minY_[other]};
+        if (CalculateDistance(bounds, otherBounds) <= radius) {
+            result.push_back(candidate);
+        }
+    }
+    return result;
+}
+
+int FlatGrid::CellX(float x) const {
+    // max(0, NaN) is 0
+    float cell = std::max(0.0f, (x - worldBounds_.x) * inverseCellSize_);
+    return static_cast<int>(std::min(cell, static_cast<float>(gridWidth_ - 1)));
+}
+
+int FlatGrid::CellY(float y) const {
+    float cell = std::max(0.0f, (y - worldBounds_.y) * inverseCellSize_);
+    return static_cast<int>(std::min(cell, static_cast<float>(gridHeight_ - 1)));
+}
+
+FlatGrid::CellRange FlatGrid::GetCellRange(float minX, float minY, float maxX, float maxY) const {
+    return {CellX(minX), CellY(minY), CellX(maxX), CellY(maxY)};
+}
+
+uint32_t FlatGrid::FindSlot(EntityID entity) const {
+    uint32_t index = GetEntityIndex(entity);
+    if (index >= slots_.size()) {
+        return NOT_STORED;
+    }
+    uint32_t slot = slots_[index];
+    if (slot == NOT_STORED || entities_[slot] != entity) {
+        return NOT_STORED;
+    }
+    return slot;
+}
+
+} // namespace engine::ECS
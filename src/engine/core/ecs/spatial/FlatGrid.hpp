@@ -0,0 +1,101 @@
+// src/engine/core/ecs/spatial/FlatGrid.hpp
+
+#pragma once
+
+#include "SpatialPartition.hpp"
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace engine::ECS {
+
+// Uniform grid kept in flat arrays and rebuilt in one go. It suits scenes
+// where most entities move every frame. Insert/Update/Remove only edit a
+// packed SoA list of bounds. The next query rebuilds every cell with a
+// counting sort: count per cell, prefix sum, scatter. The result is one
+// contiguous EntityID array, with each entry's bounds copied next to it, so
+// a cell scan never leaves those arrays.
+//
+// Each entity sits in exactly one cell, the one holding its center, so
+// queries need no dedup. Queries widen by the largest half-extent in the
+// grid to catch neighbours that overlap from the next cell. Entities wider
+// or taller than a cell would widen every query, so they go on a separate
+// list that every query checks instead.
+//
+// The rebuild runs inside the first query after a change. Don't make that
+// first query from several threads at once (or call Rebuild() beforehand);
+// after that, queries only read the cells and may run concurrently.
+class FlatGrid : public SpatialPartition {
+public:
+    FlatGrid(float cellSize, const SDL_FRect& worldBounds);
+
+    void Insert(EntityID entity, const SDL_FRect& bounds) override;
+    void Update(EntityID entity, const SDL_FRect& bounds) override;
+    void Remove(EntityID entity) override;
+    void Clear() override;
+
+    std::vector<EntityID> Query(const SDL_FRect& area) const override;
+    void Query(const SDL_FRect& area, std::vector<EntityID>& out) const override;
+    std::vector<EntityID> GetNearbyEntities(EntityID entity, float radius) const override;
+
+    size_t GetEntityCount() const override { return entities_.size(); }
+    std::string GetImplementationType() const override { return "FlatGrid"; }
+    // Entries scanned by the most recent query
+    size_t GetLastQueryCount() const override { return lastQueryCount_.load(std::memory_order_relaxed); }
+    void ResetQueryStats() override { lastQueryCount_.store(0, std::memory_order_relaxed); }
+
+    // Rebuilds the cells now if anything changed since the last rebuild
+    void Rebuild() const;
+
+    float GetCellSize() const { return cellSize_; }
+    size_t GetGridWidth() const { return static_cast<size_t>(gridWidth_); }
+    size_t GetGridHeight() const { return static_cast<size_t>(gridHeight_); }
+    size_t GetTotalCells() const { return GetGridWidth() * GetGridHeight(); }
+    // Entities on the checked-by-every-query list after the last rebuild
+    size_t GetOversizedCount() const { return oversized_.size(); }
+
+private:
+    static constexpr float DEFAULT_CELL_SIZE = 64.0f;
+    static constexpr float MIN_CELL_SIZE = 16.0f;
+    static constexpr size_t MAX_GRID_CELLS = 1000000;
+    static constexpr uint32_t NOT_STORED = UINT32_MAX;
+    static constexpr uint32_t OVERSIZED = UINT32_MAX;  // In cellOf_
+
+    struct CellRange {
+        int minX, minY, maxX, maxY;
+    };
+
+    // Clamped to the grid, like SimpleGrid: outside entities land on edge cells.
+    // Branchless; NaN maps to cell 0.
+    int CellX(float x) const;
+    int CellY(float y) const;
+    CellRange GetCellRange(float minX, float minY, float maxX, float maxY) const;
+    uint32_t FindSlot(EntityID entity) const;
+
+    float cellSize_;
+    float inverseCellSize_;
+    SDL_FRect worldBounds_;
+    int gridWidth_;
+    int gridHeight_;
+
+    // Packed entity list (swap-remove); slots_ maps entity index -> position
+    std::vector<EntityID> entities_;
+    std::vector<float> minX_, minY_, maxX_, maxY_;
+    std::vector<uint32_t> slots_;
+
+    // Cell c holds entries [cellStart_[c], cellStart_[c + 1])
+    mutable std::vector<uint32_t> cellStart_;
+    mutable std::vector<EntityID> cellEntities_;
+    mutable std::vector<float> cellMinX_, cellMinY_, cellMaxX_, cellMaxY_;
+    mutable float maxHalfExtent_ = 0.0f;     // Over entities in cells
+    mutable std::vector<uint32_t> oversized_;  // Slots into the packed list
+    // Rebuild scratch
+    mutable std::vector<uint32_t> cellOf_;     // By slot
+    mutable std::vector<uint32_t> cursors_;
+    mutable bool dirty_ = true;
+
+    // Atomic like SimpleGrid's, so concurrent queries don't race on it
+    mutable std::atomic<size_t> lastQueryCount_{0};
+};
+
+} // namespace engine::ECS
@@ -1,4 +1,5 @@
 #include "QuadTree.hpp"
+#include "engine/core/log/Logger.hpp"
 #include <algorithm>
 #include <iostream>
 #include <iomanip>
@@ -107,22 +108,22 @@ QuadTree::QuadTree(int maxDepth, int maxEntitiesPerNode, const SDL_FRect& worldB
     : maxDepth_(maxDepth), maxEntitiesPerNode_(maxEntitiesPerNode), worldBounds_(worldBounds) {
     
     if (maxDepth_ <= 0) {
-        std::cerr << "[QuadTree] Warning: maxDepth must be positive, using default 8" << std::endl;
+        LOG_WARN("QuadTree") << "maxDepth must be positive, using default 8";
         maxDepth_ = 8;
     }
     
     if (maxEntitiesPerNode_ <= 0) {
-        std::cerr << "[QuadTree] Warning: maxEntitiesPerNode must be positive, using default 10" << std::endl;
+        LOG_WARN("QuadTree") << "maxEntitiesPerNode must be positive, using default 10";
         maxEntitiesPerNode_ = 10;
     }
     
     root_ = std::make_unique<QuadNode>(worldBounds_, 0);
     
     if (debugMode_) {
-        std::cout << "[QuadTree] Created with maxDepth: " << maxDepth_ 
-                  << ", maxEntitiesPerNode: " << maxEntitiesPerNode_
-                  << ", worldBounds: (" << worldBounds_.x << ", " << worldBounds_.y 
-                  << ", " << worldBounds_.w << ", " << worldBounds_.h << ")" << std::endl;
+        LOG_INFO("QuadTree") << "Created with maxDepth: " << maxDepth_ 
+                             << ", maxEntitiesPerNode: " << maxEntitiesPerNode_
+                             << ", worldBounds: (" << worldBounds_.x << ", " << worldBounds_.y 
+                             << ", " << worldBounds_.w << ", " << worldBounds_.h << ")";
     }
 }
 
@@ -135,8 +136,8 @@ void QuadTree::Insert(EntityID entity, const SDL_FRect& bounds) {
     // Check if bounds fit within world bounds
     if (!BoundsOverlap(bounds, worldBounds_)) {
         if (debugMode_) {
-            std::cerr << "[QuadTree] Warning: Entity " << entity 
-                      << " bounds are outside world bounds" << std::endl;
+            LOG_WARN("QuadTree") << "Entity " << entity 
+                                 << " bounds are outside world bounds";
         }
         return;
     }
@@ -145,7 +146,7 @@ void QuadTree::Insert(EntityID entity, const SDL_FRect& bounds) {
     InsertIntoNode(root_.get(), entity, bounds);
     
     if (debugMode_) {
-        std::cout << "[QuadTree] Inserted entity " << entity << std::endl;
+        LOG_INFO("QuadTree") << "Inserted entity " << entity;
     }
 }
 
@@ -178,7 +179,7 @@ void QuadTree::Remove(EntityID entity) {
     entityBounds_.erase(it);
     
     if (debugMode_) {
-        std::cout << "[QuadTree] Removed entity " << entity << std::endl;
+        LOG_INFO("QuadTree") << "Removed entity " << entity;
     }
 }
 
@@ -187,17 +188,21 @@ void QuadTree::Clear() {
     entityBounds_.clear();
     
     if (debugMode_) {
-        std::cout << "[QuadTree] Cleared tree" << std::endl;
+        LOG_INFO("QuadTree") << "Cleared tree";
     }
 }
 
 std::vector<EntityID> QuadTree::Query(const SDL_FRect& area) const {
-    lastQueryCount_ = 0;
     std::vector<EntityID> result;
-    QueryNode(root_.get(), area, result);
+    Query(area, result);
     return result;
 }
 
+void QuadTree::Query(const SDL_FRect& area, std::vector<EntityID>& out) const {
+    lastQueryCount_ = 0;
+    QueryNode(root_.get(), area, out);
+}
+
 std::vector<EntityID> QuadTree::GetNearbyEntities(EntityID entity, float radius) const {
     auto it = entityBounds_.find(entity);
     if (it == entityBounds_.end()) {
@@ -237,7 +242,7 @@ size_t QuadTree::GetEntityCount() const {
 
 void QuadTree::SetMaxDepth(int maxDepth) {
     if (maxDepth <= 0) {
-        std::cerr << "[QuadTree] Warning: maxDepth must be positive" << std::endl;
+        LOG_WARN("QuadTree") << "maxDepth must be positive";
         return;
     }
     
@@ -256,7 +261,7 @@ void QuadTree::SetMaxDepth(int maxDepth) {
 
 void QuadTree::SetMaxEntitiesPerNode(int maxEntitiesPerNode) {
     if (maxEntitiesPerNode <= 0) {
-        std::cerr << "[QuadTree] Warning: maxEntitiesPerNode must be positive" << std::endl;
+        LOG_WARN("QuadTree") << "maxEntitiesPerNode must be positive";
         return;
     }
     
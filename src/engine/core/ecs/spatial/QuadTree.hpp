@@ -47,6 +47,7 @@ public:
     void Clear() override;
     
     std::vector<EntityID> Query(const SDL_FRect& area) const override;
+    void Query(const SDL_FRect& area, std::vector<EntityID>& out) const override;
     std::vector<EntityID> GetNearbyEntities(EntityID entity, float radius) const override;
     size_t GetEntityCount() const override;
     std::string GetImplementationType() const override { return "QuadTree"; }
@@ -1,4 +1,5 @@
 #include "SimpleGrid.hpp"
+#include "engine/core/log/Logger.hpp"
 #include <algorithm>
 #include <cmath>
 #include <iostream>
@@ -11,7 +12,7 @@ SimpleGrid::SimpleGrid(float cellSize, const SDL_FRect& worldBounds)
     : cellSize_(cellSize), worldBounds_(worldBounds) {
     
     if(cellSize <= 0.0f) {
-        std::cerr << "[SimpleGrid] Warning: cellSize must be positive, using default 64.0f" << std::endl;
+        LOG_WARN("SimpleGrid") << "cellSize must be positive, using default 64.0f";
         cellSize_ = 64.0f;
     }
 
@@ -21,8 +22,8 @@ SimpleGrid::SimpleGrid(float cellSize, const SDL_FRect& worldBounds)
     size_t totalCells = gridWidth_ * gridHeight_;
     
     if (totalCells > MAX_GRID_CELLS) {
-        std::cerr << "[SimpleGrid] Error: Grid would have " << totalCells 
-                  << " cells, exceeding maximum of " << MAX_GRID_CELLS << std::endl;
+        LOG_ERROR("SimpleGrid") << "Grid would have " << totalCells 
+                                << " cells, exceeding maximum of " << MAX_GRID_CELLS;
         float minCellSize = std::sqrt((worldBounds.w * worldBounds.h) / MAX_GRID_CELLS);
         cellSize_ = std::max(minCellSize * 1.1f, MIN_CELL_SIZE);
         gridWidth_ = static_cast<size_t>(std::ceil(worldBounds.w / cellSize_));
@@ -34,8 +35,8 @@ SimpleGrid::SimpleGrid(float cellSize, const SDL_FRect& worldBounds)
     lastOptimizeTime_ = std::chrono::high_resolution_clock::now();
 
     if (debugMode_) {
-        std::cout << "[SimpleGrid] Created grid: " << gridWidth_ << "x" << gridHeight_ 
-                  << " (" << totalCells << " cells), cellSize: " << cellSize_ << std::endl;
+        LOG_INFO("SimpleGrid") << "Created grid: " << gridWidth_ << "x" << gridHeight_ 
+                               << " (" << totalCells << " cells), cellSize: " << cellSize_;
     }
 }
 
@@ -51,8 +52,8 @@ void SimpleGrid::Insert(EntityID entity, const SDL_FRect& bounds) {
     AddEntityToCells(entity, entityData_[entity].cells);
 
     if (debugMode_) {
-        std::cout << "[SimpleGrid] Inserted entity " << entity 
-                  << " into " << cells.size() << " cells" << std::endl;
+        LOG_INFO("SimpleGrid") << "Inserted entity " << entity 
+                               << " into " << cells.size() << " cells";
     }
 }
 
@@ -103,7 +104,7 @@ void SimpleGrid::Remove(EntityID entity) {
     entityData_.erase(it);
 
     if (debugMode_) {
-        std::cout << "[SimpleGrid] Removed entity " << entity << std::endl;
+        LOG_INFO("SimpleGrid") << "Removed entity " << entity;
     }
 }
 
@@ -114,7 +115,7 @@ void SimpleGrid::Clear() {
     entityData_.clear();
 
     if (debugMode_) {
-        std::cout << "[SimpleGrid] Cleared grid" << std::endl;
+        LOG_INFO("SimpleGrid") << "Cleared grid";
     }
 }
 
@@ -186,7 +187,7 @@ std::vector<EntityID> SimpleGrid::GetNearbyEntities(EntityID entity, float radiu
 
 void SimpleGrid::SetCellSize(float cellSize) {
     if (cellSize <= 0.0f) {
-        std::cerr << "[SimpleGrid] Warning: cellSize must be positive" << std::endl;
+        LOG_WARN("SimpleGrid") << "cellSize must be positive";
         return;
     }
     
@@ -195,9 +196,9 @@ void SimpleGrid::SetCellSize(float cellSize) {
     size_t newTotalCells = newGridWidth * newGridHeight;
     
     if (newTotalCells > MAX_GRID_CELLS) {
-        std::cerr << "[SimpleGrid] Warning: New cell size would create " 
-                  << newTotalCells << " cells, exceeding limit of " 
-                  << MAX_GRID_CELLS << std::endl;
+        LOG_WARN("SimpleGrid") << "New cell size would create " 
+                               << newTotalCells << " cells, exceeding limit of " 
+                               << MAX_GRID_CELLS;
         return;
     }
     
@@ -316,10 +317,10 @@ float SimpleGrid::GetOptimalCellSize() const {
     }
     
     if (debugMode_) {
-        std::cout << "[SimpleGrid] Optimal cell size calculation:" << std::endl;
-        std::cout << "  Current: " << cellSize_ << ", Optimal: " << optimalCellSize << std::endl;
-        std::cout << "  Avg entity size: " << avgEntitySize << std::endl;
-        std::cout << "  Target entities per cell: " << TARGET_ENTITIES_PER_CELL << std::endl;
+        LOG_DEBUG("SimpleGrid") << "Optimal cell size: current=" << cellSize_
+                                << " optimal=" << optimalCellSize
+                                << " avgEntitySize=" << avgEntitySize
+                                << " targetPerCell=" << TARGET_ENTITIES_PER_CELL;
     }
     
     return optimalCellSize;
@@ -341,8 +342,8 @@ void SimpleGrid::OptimizeCellSize() {
     
     if (sizeDifference > cellSize_ * 0.2f) {
         if (debugMode_) {
-            std::cout << "[SimpleGrid] Auto-optimizing cell size from " 
-                      << cellSize_ << " to " << optimalSize << std::endl;
+            LOG_INFO("SimpleGrid") << "Auto-optimizing cell size from " 
+                                   << cellSize_ << " to " << optimalSize;
         }
         SetCellSize(optimalSize);
         lastOptimizeTime_ = now;
@@ -358,7 +359,7 @@ void SimpleGrid::ResetPerformanceStats() {
     lastQueryCount_.store(0);
     
     if (debugMode_) {
-        std::cout << "[SimpleGrid] Performance statistics reset" << std::endl;
+        LOG_INFO("SimpleGrid") << "Performance statistics reset";
     }
 }
 
@@ -20,6 +20,7 @@ public:
     void Clear() override;
     
     std::vector<EntityID> Query(const SDL_FRect& area) const override;
+    using SpatialPartition::Query;
     std::vector<EntityID> GetNearbyEntities(EntityID entity, float radius) const override;
     
     size_t GetEntityCount() const override { return entityData_.size(); }
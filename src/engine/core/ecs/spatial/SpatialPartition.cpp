@@ -1,7 +1,8 @@
 #include "SpatialPartition.hpp"
 #include "SimpleGrid.hpp"
 #include "QuadTree.hpp"
-#include <iostream>
+#include "FlatGrid.hpp"
+#include "engine/core/log/Logger.hpp"
 
 namespace engine::ECS {
 
@@ -13,13 +14,16 @@ std::unique_ptr<SpatialPartition> SpatialPartitionFactory::Create(Type type, con
         case Type::QUAD_TREE:
             return CreateQuadTree(8, 10, worldBounds); // Default values
             
+        case Type::FLAT_GRID:
+            return CreateFlatGrid(64.0f, worldBounds);
+            
         case Type::ADAPTIVE:
             // For now, use QuadTree as adaptive implementation
-            std::cout << "[SpatialPartitionFactory] ADAPTIVE type not fully implemented, using QuadTree" << std::endl;
+            LOG_INFO("SpatialPartitionFactory") << "ADAPTIVE type not fully implemented, using QuadTree";
             return CreateQuadTree(8, 10, worldBounds);
             
         default:
-            std::cerr << "[SpatialPartitionFactory] Unknown type, defaulting to SimpleGrid" << std::endl;
+            LOG_ERROR("SpatialPartitionFactory") << "Unknown type, defaulting to SimpleGrid";
             return CreateGrid(64.0f, worldBounds);
     }
 }
@@ -28,6 +32,10 @@ std::unique_ptr<SpatialPartition> SpatialPartitionFactory::CreateGrid(float cell
     return std::make_unique<SimpleGrid>(cellSize, worldBounds);
 }
 
+std::unique_ptr<SpatialPartition> SpatialPartitionFactory::CreateFlatGrid(float cellSize, const SDL_FRect& worldBounds) {
+    return std::make_unique<FlatGrid>(cellSize, worldBounds);
+}
+
 std::unique_ptr<SpatialPartition> SpatialPartitionFactory::CreateQuadTree(int maxDepth, int maxEntitiesPerNode, const SDL_FRect& worldBounds) {
     return std::make_unique<QuadTree>(maxDepth, maxEntitiesPerNode, worldBounds);
 }
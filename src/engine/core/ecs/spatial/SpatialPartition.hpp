@@ -23,6 +23,12 @@ public:
     virtual void Clear() = 0;
     
     virtual std::vector<EntityID> Query(const SDL_FRect& area) const = 0;
+    // Appends matches to out, so a caller-owned vector can be reused across
+    // queries. The default copies from the by-value Query
+    virtual void Query(const SDL_FRect& area, std::vector<EntityID>& out) const {
+        std::vector<EntityID> found = Query(area);
+        out.insert(out.end(), found.begin(), found.end());
+    }
     virtual std::vector<EntityID> GetNearbyEntities(EntityID entity, float radius) const = 0;
     
     virtual size_t GetEntityCount() const = 0;
@@ -61,11 +67,13 @@ public:
     enum class Type {
         SIMPLE_GRID,
         QUAD_TREE,
+        FLAT_GRID,
         ADAPTIVE
     };
     
     static std::unique_ptr<SpatialPartition> Create(Type type, const SDL_FRect& worldBounds);
     static std::unique_ptr<SpatialPartition> CreateGrid(float cellSize, const SDL_FRect& worldBounds);
+    static std::unique_ptr<SpatialPartition> CreateFlatGrid(float cellSize, const SDL_FRect& worldBounds);
     static std::unique_ptr<SpatialPartition> CreateQuadTree(int maxDepth, int maxEntitiesPerNode, const SDL_FRect& worldBounds);
 };
 
@@ -4,13 +4,17 @@
 #include "engine/core/ecs/World.hpp"
 #include "engine/core/ecs/components/Transform2D.hpp"
 #include "engine/core/ecs/components/Velocity2D.hpp"
+#include "engine/core/log/Logger.hpp"
 #include <cmath>
-#include <iostream>
 
 namespace engine::ECS {
 
+SystemAccess AISystem::GetAccess() const {
+    return SystemAccess().Read<Transform2D>().Write<AIComponent>().Write<Velocity2D>();
+}
+
 void AISystem::Init() {
-    std::cout << "[AISystem] AI system initialized" << std::endl;
+    LOG_INFO("AISystem") << "AI system initialized";
 }
 
 void AISystem::Update(float deltaTime) {
@@ -42,7 +46,7 @@ void AISystem::Update(float deltaTime) {
 }
 
 void AISystem::Shutdown() {
-    std::cout << "[AISystem] AI system shutdown" << std::endl;
+    LOG_INFO("AISystem") << "AI system shutdown";
 }
 
 
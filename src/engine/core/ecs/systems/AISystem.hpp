@@ -16,6 +16,7 @@ public:
     void Init() override;
     void Update(float deltaTime) override;
     void Shutdown() override;
+    SystemAccess GetAccess() const override;
 
 protected:
     
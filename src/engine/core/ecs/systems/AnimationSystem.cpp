@@ -5,10 +5,16 @@
 #include "engine/core/ecs/components/SpriteAnimation.hpp"
 #include "engine/core/ecs/components/AnimationState.hpp"
 #include "engine/core/ecs/components/Sprite2D.hpp"
+#include "engine/core/log/Logger.hpp"
 #include <SDL3/SDL.h>
 
 namespace engine::ECS {
 
+// Loads textures through ResourceManager, which wraps the SDL renderer
+SystemAccess AnimationSystem::GetAccess() const {
+    return SystemAccess().Read<SpriteAnimation>().Write<AnimationState>().Write<Sprite2D>().MainThread();
+}
+
 AnimationSystem::AnimationSystem(engine::resources::ResourceManager* resourceManager)
     : resourceManager_(resourceManager) {
 }
@@ -22,75 +28,54 @@ void AnimationSystem::Update(float deltaTime) {
     auto& componentManager = world->GetComponentManager();
     
     // Get all entities that have animation components
-    auto entities = componentManager.GetEntitiesWithComponents<SpriteAnimation, AnimationState, Sprite2D>();
+    auto view = componentManager.GetView<SpriteAnimation, AnimationState, Sprite2D>();
     
-    for (EntityID entityId : entities) {
-        auto* animation = componentManager.GetComponent<SpriteAnimation>(entityId);
-        auto* state = componentManager.GetComponent<AnimationState>(entityId);
-        auto* sprite = componentManager.GetComponent<Sprite2D>(entityId);
-        
-        if (!animation || !state || !sprite) {
-            continue;
-        }
-        
+    for (auto [entityId, animation, state, sprite] : view) {
         // Skip if animation is not playing or auto-play is disabled and not started
-        if (!state->isPlaying) {
+        if (!state.isPlaying) {
             continue;
         }
         
         // Skip if animation has completed and doesn't loop
-        if (state->hasCompleted && !animation->loop) {
+        if (state.hasCompleted && !animation.loop) {
             continue;
         }
         
         // Update elapsed time
-        state->elapsedTime += deltaTime;
+        state.elapsedTime += deltaTime;
         
         // Check if it's time to advance to the next frame
-        if (state->elapsedTime >= animation->frameDuration) {
-            state->elapsedTime -= animation->frameDuration;
-            state->currentFrame++;
+        if (state.elapsedTime >= animation.frameDuration) {
+            state.elapsedTime -= animation.frameDuration;
+            state.currentFrame++;
             
             // Handle looping or completion
-            if (state->currentFrame >= animation->frameCount) {
-                if (animation->loop) {
-                    state->currentFrame = 0;
-                    state->loopCount++;
+            if (state.currentFrame >= animation.frameCount) {
+                if (animation.loop) {
+                    state.currentFrame = 0;
+                    state.loopCount++;
                 } else {
-                    state->currentFrame = animation->frameCount - 1;
-                    state->hasCompleted = true;
-                    state->isPlaying = false;
+                    state.currentFrame = animation.frameCount - 1;
+                    state.hasCompleted = true;
+                    state.isPlaying = false;
                 }
             }
             
             // Update the sprite's sourceRect
-            UpdateAnimationFrame(entityId);
+            UpdateAnimationFrame(entityId, &animation, &state, &sprite);
+            componentManager.MarkChanged<Sprite2D>(entityId);
         }
     }
 }
 
-void AnimationSystem::UpdateAnimationFrame(EntityID entityId) {
-    auto* world = GetWorld();
-    if (!world) {
-        return;
-    }
-    
-    auto& componentManager = world->GetComponentManager();
-    
-    auto* animation = componentManager.GetComponent<SpriteAnimation>(entityId);
-    auto* state = componentManager.GetComponent<AnimationState>(entityId);
-    auto* sprite = componentManager.GetComponent<Sprite2D>(entityId);
-    
-    if (!animation || !state || !sprite) {
-        return;
-    }
-    
+void AnimationSystem::UpdateAnimationFrame(EntityID entityId, const SpriteAnimation* animation,
+                                           const AnimationState* state, Sprite2D* sprite) {
     // Calculate frame dimensions if not explicitly set
     int frameWidth = animation->frameWidth;
     int frameHeight = animation->frameHeight;
     
     if (frameWidth == 0 || frameHeight == 0) {
-        CalculateFrameDimensions(sprite->texturePath, animation->framesPerRow, frameWidth, frameHeight);
+        CalculateFrameDimensions(sprite, animation->framesPerRow, frameWidth, frameHeight);
     }
     
     // Calculate source rectangle for current frame
@@ -106,37 +91,31 @@ void AnimationSystem::UpdateAnimationFrame(EntityID entityId) {
     sprite->sourceRect.w = frameWidth;
     sprite->sourceRect.h = frameHeight;
     
-    // Debug output for sprite cutting
-    static int debugCount = 0;
-    if (debugCount < 10) { // Only show first 10 updates
-        std::cout << "*** [AnimationSystem] Entity " << entityId 
-                  << " Frame " << currentFrame << ": sourceRect(" 
-                  << frameX << "," << frameY << "," << frameWidth << "," << frameHeight 
-                  << ") ***" << std::endl;
-        debugCount++;
-    }
+    LOG_DEBUG_EVERY("AnimationSystem", 2000) << "Entity " << entityId 
+                                             << " Frame " << currentFrame << ": sourceRect(" 
+                                             << frameX << "," << frameY << "," << frameWidth << "," << frameHeight << ")";
 }
 
-void AnimationSystem::CalculateFrameDimensions(const std::string& texturePath, int framesPerRow, int& frameWidth, int& frameHeight) {
+void AnimationSystem::CalculateFrameDimensions(Sprite2D* sprite, int framesPerRow, int& frameWidth, int& frameHeight) {
     if (!resourceManager_) {
         frameWidth = frameHeight = 64; // Default fallback
         return;
     }
     
-    SDL_Texture* texture = resourceManager_->GetTexture(texturePath);
-    if (!texture) {
-        // Try loading the texture
-        texture = resourceManager_->LoadTexture(texturePath);
+    const resources::TextureRegion* region = resourceManager_->GetTextureRegion(sprite->texture);
+    if (!region) {
+        // Resolve (loading if needed) once; later frames reuse the handle
+        sprite->texture = resourceManager_->GetTextureHandle(sprite->texturePath);
+        if (!sprite->texture.IsValid()) {
+            sprite->texture = resourceManager_->LoadTextureHandle(sprite->texturePath);
+        }
+        region = resourceManager_->GetTextureRegion(sprite->texture);
     }
     
-    if (texture) {
-        float textureWidth, textureHeight;
-        if (SDL_GetTextureSize(texture, &textureWidth, &textureHeight)) {
-            frameWidth = static_cast<int>(textureWidth) / framesPerRow;
-            frameHeight = static_cast<int>(textureHeight); // Assume single row for now
-        } else {
-            frameWidth = frameHeight = 64; // Default fallback
-        }
+    // The image's own size, which differs from its texture's when packed
+    if (region && region->rect.w > 0 && region->rect.h > 0) {
+        frameWidth = region->rect.w / framesPerRow;
+        frameHeight = region->rect.h; // Assume single row for now
     } else {
         frameWidth = frameHeight = 64; // Default fallback
     }
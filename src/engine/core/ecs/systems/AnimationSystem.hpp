@@ -3,6 +3,9 @@
 #pragma once
 
 #include "engine/core/ecs/System.hpp"
+#include "engine/core/ecs/components/SpriteAnimation.hpp"
+#include "engine/core/ecs/components/AnimationState.hpp"
+#include "engine/core/ecs/components/Sprite2D.hpp"
 #include "engine/resource/ResourceManager.hpp"
 #include "engine/core/Types.hpp"
 
@@ -17,10 +20,13 @@ public:
 
     void Update(float deltaTime) override;
     const char* GetName() const override { return "AnimationSystem"; }
+    SystemAccess GetAccess() const override;
+    SystemPhase GetPhase() const override { return SystemPhase::Render; }
 
 private:
-    void UpdateAnimationFrame(engine::EntityID entityId);
-    void CalculateFrameDimensions(const std::string& texturePath, int framesPerRow, int& frameWidth, int& frameHeight);
+    void UpdateAnimationFrame(engine::EntityID entityId, const SpriteAnimation* animation,
+                              const AnimationState* state, Sprite2D* sprite);
+    void CalculateFrameDimensions(Sprite2D* sprite, int framesPerRow, int& frameWidth, int& frameHeight);
 
     engine::resources::ResourceManager* resourceManager_;
 };
@@ -3,11 +3,35 @@
 #include "CollisionSystem.hpp"
 #include "engine/core/ecs/World.hpp"
 #include "engine/core/ecs/spatial/SpatialPartition.hpp"
+#include "engine/core/profiling/TraceProfiler.hpp"
+#include "engine/core/log/Logger.hpp"
 #include <iostream>
 #include <algorithm>
 
 namespace engine::ECS {
 
+namespace {
+
+bool SameBounds(const SDL_FRect& a, const SDL_FRect& b) {
+    return a.x == b.x && a.y == b.y && a.w == b.w && a.h == b.h;
+}
+
+const char* SpatialTypeName(CollisionSystem::SpatialType type) {
+    switch (type) {
+        case CollisionSystem::SpatialType::BRUTE_FORCE: return "BruteForce";
+        case CollisionSystem::SpatialType::SIMPLE_GRID: return "SimpleGrid";
+        case CollisionSystem::SpatialType::QUAD_TREE:   return "QuadTree";
+        case CollisionSystem::SpatialType::FLAT_GRID:   return "FlatGrid";
+    }
+    return "Unknown";
+}
+
+} // namespace
+
+SystemAccess CollisionSystem::GetAccess() const {
+    return SystemAccess().Read<Transform2D>().Read<Collider2D>();
+}
+
 CollisionSystem::CollisionSystem()
     : collisionCheckCount_(0)
     , collisionCount_(0)
@@ -17,13 +41,23 @@ CollisionSystem::CollisionSystem()
 }
 
 void CollisionSystem::Init() {
-    std::cout << "[CollisionSystem] Initialized" << std::endl;
+    if (world_) {
+        auto& componentManager = world_->GetComponentManager();
+        transforms_ = componentManager.GetComponentStore<Transform2D>();
+        colliders_ = componentManager.GetComponentStore<Collider2D>();
+
+        // Losing either component takes the entity out of the partition
+        auto onRemove = [this](EntityID entityId, auto&) { RemoveFromSpatialPartition(entityId); };
+        transformRemoveObserver_ = transforms_->AddObserver(ComponentEvent::Remove, onRemove);
+        colliderRemoveObserver_ = colliders_->AddObserver(ComponentEvent::Remove, onRemove);
+    }
+    LOG_INFO("CollisionSystem") << "Initialized";
 
     InitializeSpatialPartition();
 }
 
 void CollisionSystem::Update(float deltaTime) {
-    if (!world_) {
+    if (!world_ || !transforms_ || !colliders_) {
         return;
     }
 
@@ -31,32 +65,22 @@ void CollisionSystem::Update(float deltaTime) {
     collisionCheckCount_ = 0;
     collisionCount_ = 0;
     
-    // Clear previous frame's data
+    // Clear previous frame's data; the arrays keep their capacity
     entitiesWithColliders_.clear();
-    colliderBoundsCache_.clear();
-    entityDataCache_.clear();
-    
-    auto& componentManager = world_->GetComponentManager();
-    auto entitiesWithTransform = componentManager.GetEntitiesWithComponent<Transform2D>();
-    entitiesWithColliders_.reserve(entitiesWithTransform.size());
+    colliderBounds_.clear();
+    colliderComponents_.clear();
     
-    for (auto entityId : entitiesWithTransform) {
-        auto* collider = componentManager.GetComponent<Collider2D>(entityId);
-        if (!collider) continue;
-        
-        auto* transform = componentManager.GetComponent<Transform2D>(entityId);
-        if (!transform) continue;
-        
-        entitiesWithColliders_.push_back(entityId);
-        
+    // Only entities with both components are visited, no per-entity lookups
+    for (auto [entityId, collider, transform] : View<Collider2D, Transform2D>(colliders_, transforms_)) {
         SDL_FRect worldBounds;
-        worldBounds.x = transform->x + collider->bounds.x * transform->scaleX;
-        worldBounds.y = transform->y + collider->bounds.y * transform->scaleY;
-        worldBounds.w = collider->bounds.w * transform->scaleX;
-        worldBounds.h = collider->bounds.h * transform->scaleY;
+        worldBounds.x = transform.x + collider.bounds.x * transform.scaleX;
+        worldBounds.y = transform.y + collider.bounds.y * transform.scaleY;
+        worldBounds.w = collider.bounds.w * transform.scaleX;
+        worldBounds.h = collider.bounds.h * transform.scaleY;
         
-        colliderBoundsCache_[entityId] = worldBounds;
-        entityDataCache_[entityId] = {collider, worldBounds};
+        entitiesWithColliders_.push_back(entityId);
+        colliderBounds_.push_back(worldBounds);
+        colliderComponents_.push_back(&collider);
     }
 
     if (currentSpatialType_ == SpatialType::BRUTE_FORCE) {
@@ -68,30 +92,42 @@ void CollisionSystem::Update(float deltaTime) {
     
     #ifdef DEBUG
     if (collisionCheckCount_ > 0) {
-        std::cout << "[CollisionSystem] Checks: " << collisionCheckCount_ 
-                  << ", Collisions: " << collisionCount_ << std::endl;
+        LOG_DEBUG("CollisionSystem") << "Checks: " << collisionCheckCount_ 
+                                     << ", Collisions: " << collisionCount_;
     }
     #endif
 }
 
 void CollisionSystem::Shutdown() {
-    std::cout << "[CollisionSystem] Shutdown" << std::endl;
+    LOG_INFO("CollisionSystem") << "Shutdown";
+    if (transforms_ && transformRemoveObserver_) {
+        transforms_->RemoveObserver(transformRemoveObserver_);
+    }
+    if (colliders_ && colliderRemoveObserver_) {
+        colliders_->RemoveObserver(colliderRemoveObserver_);
+    }
+    transformRemoveObserver_ = colliderRemoveObserver_ = 0;
     entitiesWithColliders_.clear();
-    colliderBoundsCache_.clear();
-    entityDataCache_.clear();
+    colliderBounds_.clear();
+    colliderComponents_.clear();
+    indexedColliders_.clear();
+    if (spatialPartition_) {
+        spatialPartition_->Clear();
+    }
+    spatialPartitionSynced_ = false;
 }
 
 void CollisionSystem::AddCollisionLayer(const std::string& layer, bool enabled) {
     enabledLayers_[layer] = enabled;
-    std::cout << "[CollisionSystem] Added layer: " << layer 
-              << " (" << (enabled ? "enabled" : "disabled") << ")" << std::endl;
+    LOG_INFO("CollisionSystem") << "Added layer: " << layer 
+                                << " (" << (enabled ? "enabled" : "disabled") << ")";
 }
 
 void CollisionSystem::SetCollisionRule(const std::string& layerA, const std::string& layerB, bool canCollide) {
     collisionRules_[layerA][layerB] = canCollide;
     collisionRules_[layerB][layerA] = canCollide; // Symmetric rule
-    std::cout << "[CollisionSystem] Rule: " << layerA << " <-> " << layerB 
-              << " = " << (canCollide ? "collide" : "ignore") << std::endl;
+    LOG_INFO("CollisionSystem") << "Rule: " << layerA << " <-> " << layerB 
+                                << " = " << (canCollide ? "collide" : "ignore");
 }
 
 bool CollisionSystem::CheckAABBCollision(const SDL_FRect& a, const SDL_FRect& b) const {
@@ -172,10 +208,15 @@ bool CollisionSystem::canLayersCollide(const std::string& layerA, const std::str
 void CollisionSystem::ResetStats() {
     collisionCheckCount_ = 0;
     collisionCount_ = 0;
+    spatialUpdateCount_ = 0;
 }
 
 // Spatial Related Code
 void CollisionSystem::InitializeSpatialPartition() {
+    // A new (or no) partition starts empty; the next update fills it
+    indexedColliders_.clear();
+    spatialPartitionSynced_ = false;
+
     if (currentSpatialType_ == SpatialType::BRUTE_FORCE) {
         spatialPartition_.reset();
         return;
@@ -185,11 +226,15 @@ void CollisionSystem::InitializeSpatialPartition() {
     switch (currentSpatialType_) {
         case SpatialType::SIMPLE_GRID:
             spatialPartition_ = SpatialPartitionFactory::CreateGrid(gridCellSize_, worldBounds_);
-            std::cout << "[CollisionSystem] Initialized SimpleGrid with cellSize:" << gridCellSize_ << std::endl;
+            LOG_INFO("CollisionSystem") << "Initialized SimpleGrid with cellSize:" << gridCellSize_;
             break;
         case SpatialType::QUAD_TREE:
             spatialPartition_ = SpatialPartitionFactory::CreateQuadTree(quadTreeMaxDepth_, quadTreeMaxEntities_, worldBounds_);
-            std::cout << "[CollisionSystem] Initialized QuadTree with maxDepth: " << quadTreeMaxDepth_ << ", maxEntities: " << quadTreeMaxEntities_ << std::endl;
+            LOG_INFO("CollisionSystem") << "Initialized QuadTree with maxDepth: " << quadTreeMaxDepth_ << ", maxEntities: " << quadTreeMaxEntities_;
+            break;
+        case SpatialType::FLAT_GRID:
+            spatialPartition_ = SpatialPartitionFactory::CreateFlatGrid(gridCellSize_, worldBounds_);
+            LOG_INFO("CollisionSystem") << "Initialized FlatGrid with cellSize:" << gridCellSize_;
             break;
         default:
             spatialPartition_.reset();
@@ -197,72 +242,114 @@ void CollisionSystem::InitializeSpatialPartition() {
 }
 
 void CollisionSystem::UpdateSpatialPartition() {
+    PROFILE_SCOPE("CollisionSystem::UpdateSpatialPartition");
+
+    spatialUpdateCount_ = 0;
     if (!spatialPartition_) return;
 
-    spatialPartition_->Clear();
+    if (!spatialPartitionSynced_) {
+        spatialPartition_->Clear();
+        indexedColliders_.clear();
+        spatialPartitionSynced_ = true;
+    }
+
+    // Colliders that haven't moved cost one bounds compare; removed ones
+    // were already taken out by the component observers
+    for (size_t i = 0; i < entitiesWithColliders_.size(); ++i) {
+        EntityID entityId = entitiesWithColliders_[i];
+        const SDL_FRect& bounds = colliderBounds_[i];
 
-    for (auto entityId : entitiesWithColliders_) {
-        auto it = colliderBoundsCache_.find(entityId);
-        if (it != colliderBoundsCache_.end()) {
-            spatialPartition_->Insert(entityId, it->second);
+        uint32_t index = GetEntityIndex(entityId);
+        if (index >= indexedColliders_.size()) {
+            indexedColliders_.resize(index + 1);
+        }
+        IndexedCollider& indexed = indexedColliders_[index];
+        if (indexed.entityId != entityId) {
+            if (indexed.entityId != INVALID_ENTITY) {
+                spatialPartition_->Remove(indexed.entityId);
+            }
+            spatialPartition_->Insert(entityId, bounds);
+            indexed.entityId = entityId;
+            indexed.bounds = bounds;
+            spatialUpdateCount_++;
+        } else if (!SameBounds(indexed.bounds, bounds)) {
+            spatialPartition_->Update(entityId, bounds);
+            indexed.bounds = bounds;
+            spatialUpdateCount_++;
         }
+        indexed.slot = static_cast<uint32_t>(i);
     }
 }
+
+void CollisionSystem::RemoveFromSpatialPartition(EntityID entityId) {
+    uint32_t index = GetEntityIndex(entityId);
+    if (!spatialPartition_ || entityId == INVALID_ENTITY || index >= indexedColliders_.size()) {
+        return;
+    }
+    IndexedCollider& indexed = indexedColliders_[index];
+    if (indexed.entityId != entityId) {
+        return;
+    }
+    spatialPartition_->Remove(entityId);
+    indexed = IndexedCollider{};
+}
     
 void CollisionSystem::PerformBruteForceCollisionDetection() {
     for (size_t i = 0; i < entitiesWithColliders_.size(); ++i) {
-        auto entityA = entitiesWithColliders_[i];
-        auto itA = entityDataCache_.find(entityA);
-        if (itA == entityDataCache_.end()) continue;
+        const Collider2D& colliderA = *colliderComponents_[i];
+        const SDL_FRect& boundsA = colliderBounds_[i];
 
         for (size_t j = i + 1; j < entitiesWithColliders_.size(); ++j) {
-            auto entityB = entitiesWithColliders_[j];
-            auto itB = entityDataCache_.find(entityB);
-            if (itB == entityDataCache_.end()) continue;
+            const Collider2D& colliderB = *colliderComponents_[j];
             
             collisionCheckCount_++;
             
-            if (!canLayersCollide(itA->second.collider->layer, itB->second.collider->layer)) {
+            if (!canLayersCollide(colliderA.layer, colliderB.layer)) {
                 continue;
             }
 
-            if (CheckAABBCollision(itA->second.worldBounds, itB->second.worldBounds)) {
+            if (CheckAABBCollision(boundsA, colliderBounds_[j])) {
                 collisionCount_++;
-                ProcessCollisionSafe(entityA, entityB, *itA->second.collider, *itB->second.collider, itA->second.worldBounds, itB->second.worldBounds);
+                ProcessCollisionSafe(entitiesWithColliders_[i], entitiesWithColliders_[j], colliderA, colliderB, boundsA, colliderBounds_[j]);
             }
         }
     }
 }
 
 void CollisionSystem::PerformSpatialCollisionDetection() {
+    PROFILE_SCOPE("CollisionSystem::PerformSpatialCollisionDetection");
+
     if (!spatialPartition_) {
         PerformBruteForceCollisionDetection();
         return;
     }
 
-    for (auto entityA : entitiesWithColliders_) {
-        auto itA = entityDataCache_.find(entityA);
-        if (itA == entityDataCache_.end()) continue;
+    for (size_t i = 0; i < entitiesWithColliders_.size(); ++i) {
+        EntityID entityA = entitiesWithColliders_[i];
+        const Collider2D& colliderA = *colliderComponents_[i];
+        const SDL_FRect& boundsA = colliderBounds_[i];
 
-        std::vector<EntityID> candidates = spatialPartition_->Query(itA->second.worldBounds);
+        queryCandidates_.clear();
+        spatialPartition_->Query(boundsA, queryCandidates_);
 
-        for (auto entityB : candidates) {
+        for (auto entityB : queryCandidates_) {
             if (entityA >= entityB) continue;
 
-            auto itB = entityDataCache_.find(entityB);
-            if (itB == entityDataCache_.end()) continue;
+            // Everything in the partition was visited this frame and has a slot
+            uint32_t indexB = GetEntityIndex(entityB);
+            if (indexB >= indexedColliders_.size() || indexedColliders_[indexB].entityId != entityB) continue;
+            uint32_t j = indexedColliders_[indexB].slot;
+            const Collider2D& colliderB = *colliderComponents_[j];
 
             collisionCheckCount_++;
 
-            if (!canLayersCollide(itA->second.collider->layer, itB->second.collider->layer)) {
+            if (!canLayersCollide(colliderA.layer, colliderB.layer)) {
                 continue;
             }
 
-            if (CheckAABBCollision(itA->second.worldBounds, itB->second.worldBounds)) {
+            if (CheckAABBCollision(boundsA, colliderBounds_[j])) {
                 collisionCount_++;
-                ProcessCollisionSafe(entityA, entityB, 
-                                   *itA->second.collider, *itB->second.collider,
-                                   itA->second.worldBounds, itB->second.worldBounds);
+                ProcessCollisionSafe(entityA, entityB, colliderA, colliderB, boundsA, colliderBounds_[j]);
             }
         }
     }
@@ -283,15 +370,13 @@ void CollisionSystem::SetSpatialType(SpatialType type) {
     if (currentSpatialType_ != type) {
         currentSpatialType_ = type;
         InitializeSpatialPartition();
-        std::cout << "[CollisionSystem] Switched to " << 
-            (type == SpatialType::BRUTE_FORCE ? "BruteForce" :
-             type == SpatialType::SIMPLE_GRID ? "SimpleGrid" : "QuadTree") << std::endl;
+        LOG_INFO("CollisionSystem") << "Switched to " << SpatialTypeName(type);
     }
 }
 
 void CollisionSystem::SetWorldBounds(const SDL_FRect& bounds) {
     if (bounds.w <= 0 || bounds.h <= 0) {
-        std::cerr << "[CollisionSystem] Warning: Invalid world bounds" << std::endl;
+        LOG_WARN("CollisionSystem") << "Invalid world bounds";
         return;
     }
     worldBounds_ = bounds;
@@ -302,25 +387,27 @@ void CollisionSystem::SetWorldBounds(const SDL_FRect& bounds) {
 
 void CollisionSystem::SetGridCellSize(float cellSize) {
     if (cellSize <= 0) {
-        std::cerr << "[CollisionSystem] Warning: Invalid cell size " << cellSize 
-                  << ", keeping current value: " << gridCellSize_ << std::endl;
+        LOG_WARN("CollisionSystem") << "Invalid cell size " << cellSize 
+                                    << ", keeping current value: " << gridCellSize_;
         return;
     }
     gridCellSize_ = cellSize;
-    if (currentSpatialType_ == SpatialType::SIMPLE_GRID && spatialPartition_) {
+    bool gridType = currentSpatialType_ == SpatialType::SIMPLE_GRID ||
+                    currentSpatialType_ == SpatialType::FLAT_GRID;
+    if (gridType && spatialPartition_) {
         InitializeSpatialPartition();
     }
 }
 
 void CollisionSystem::SetQuadTreeParams(int maxDepth, int maxEntitiesPerNode) {
     if (maxDepth <= 0 || maxDepth > 20) {
-        std::cerr << "[CollisionSystem] Warning: Invalid max depth " << maxDepth 
-                  << ", must be between 1 and 20" << std::endl;
+        LOG_WARN("CollisionSystem") << "Invalid max depth " << maxDepth 
+                                    << ", must be between 1 and 20";
         return;
     }
     if (maxEntitiesPerNode <= 0) {
-        std::cerr << "[CollisionSystem] Warning: Invalid max entities " << maxEntitiesPerNode 
-                  << ", must be positive" << std::endl;
+        LOG_WARN("CollisionSystem") << "Invalid max entities " << maxEntitiesPerNode 
+                                    << ", must be positive";
         return;
     }
     
@@ -333,12 +420,11 @@ void CollisionSystem::SetQuadTreeParams(int maxDepth, int maxEntitiesPerNode) {
 
 void CollisionSystem::PrintSpatialStats() const {
     std::cout << "\n=== CollisionSystem Spatial Stats ===" << std::endl;
-    std::cout << "Current Type: " << 
-        (currentSpatialType_ == SpatialType::BRUTE_FORCE ? "BruteForce" :
-         currentSpatialType_ == SpatialType::SIMPLE_GRID ? "SimpleGrid" : "QuadTree") << std::endl;
+    std::cout << "Current Type: " << SpatialTypeName(currentSpatialType_) << std::endl;
     std::cout << "Entities with Colliders: " << entitiesWithColliders_.size() << std::endl;
     std::cout << "Last Frame Checks: " << collisionCheckCount_ << std::endl;
     std::cout << "Last Frame Collisions: " << collisionCount_ << std::endl;
+    std::cout << "Last Frame Partition Updates: " << spatialUpdateCount_ << std::endl;
     
     if (spatialPartition_) {
         std::cout << "Spatial Partition Type: " << spatialPartition_->GetImplementationType() << std::endl;
@@ -3,6 +3,9 @@
 #pragma once
 
 #include "engine/core/ecs/System.hpp"
+#include "engine/core/ecs/ComponentStore.hpp"
+#include "engine/core/ecs/View.hpp"
+#include "engine/core/ecs/EntityHandle.hpp"
 #include "engine/core/ecs/components/Transform2D.hpp"
 #include "engine/core/ecs/components/Collider2D.hpp"
 #include "engine/core/ecs/ComponentManager.hpp" 
@@ -21,7 +24,8 @@ public:
     enum class SpatialType {
         BRUTE_FORCE,
         SIMPLE_GRID,
-        QUAD_TREE
+        QUAD_TREE,
+        FLAT_GRID     // Rebuilt by counting sort; best when most colliders move
     };
 
     CollisionSystem();
@@ -32,6 +36,7 @@ public:
     void Shutdown() override;
 
     const char* GetName() const override { return "CollisionSystem"; }
+    SystemAccess GetAccess() const override;
 
     void AddCollisionLayer(const std::string& layer, bool enabled = true);
     void SetCollisionRule(const std::string& layerA, const std::string& layerB, bool canCollide);
@@ -45,6 +50,8 @@ public:
     
     size_t GetCollisionCheckCount() const { return collisionCheckCount_; }
     size_t GetCollisionCount() const { return collisionCount_; }
+    // Partition inserts/updates last frame; colliders that didn't move add none
+    size_t GetSpatialUpdateCount() const { return spatialUpdateCount_; }
     void ResetStats();
 
     void PrintSpatialStats() const;
@@ -58,7 +65,10 @@ private:
     
     // Spatial Optimization (Reserved)
     void InitializeSpatialPartition();
+    // Keeps the partition alive across frames: new colliders are inserted,
+    // moved ones updated, unchanged ones skipped
     void UpdateSpatialPartition();
+    void RemoveFromSpatialPartition(EntityID entityId);
     void PerformBruteForceCollisionDetection();
     void PerformSpatialCollisionDetection();
 
@@ -69,14 +79,27 @@ private:
     
     size_t collisionCheckCount_ = 0;
     size_t collisionCount_ = 0;
-    struct EntityCollisionData {
-        Collider2D* collider;
-        SDL_FRect worldBounds;
-    };
-    
+    size_t spatialUpdateCount_ = 0;
+
+    // This frame's colliders, gathered from one View pass; parallel arrays
     std::vector<EntityID> entitiesWithColliders_;
-    std::unordered_map<EntityID, SDL_FRect> colliderBoundsCache_;
-    std::unordered_map<EntityID, EntityCollisionData> entityDataCache_;
+    std::vector<SDL_FRect> colliderBounds_;
+    std::vector<const Collider2D*> colliderComponents_;
+
+    // What the partition currently holds
+    struct IndexedCollider {
+        EntityID entityId = INVALID_ENTITY;  // Detects reused indices
+        SDL_FRect bounds = {0.0f, 0.0f, 0.0f, 0.0f};
+        uint32_t slot = 0;  // Into this frame's collider arrays
+    };
+    std::vector<IndexedCollider> indexedColliders_;  // By entity index
+    std::vector<EntityID> queryCandidates_;  // Reused by every broadphase query
+    bool spatialPartitionSynced_ = false;
+
+    ComponentStore<Transform2D>* transforms_ = nullptr;
+    ComponentStore<Collider2D>* colliders_ = nullptr;
+    ObserverID transformRemoveObserver_ = 0;
+    ObserverID colliderRemoveObserver_ = 0;
 
     std::unique_ptr<SpatialPartition> spatialPartition_;
     SpatialType currentSpatialType_ = SpatialType::BRUTE_FORCE;
@@ -5,11 +5,15 @@
 #include "engine/core/ecs/components/Transform2D.hpp"
 #include "engine/core/ecs/components/Sprite2D.hpp"
 #include "engine/input/InputManager.hpp"
-#include <iostream>
+#include "engine/core/log/Logger.hpp"
 #include <sstream>
 
 namespace engine::ECS {
 
+SystemAccess DebugRenderSystem::GetAccess() const {
+    return SystemAccess().Read<Transform2D>().Read<Sprite2D>().MainThread();
+}
+
 DebugRenderSystem::DebugRenderSystem(SDL_Renderer* renderer, engine::input::InputManager* inputManager)
     : renderer_(renderer)
     , inputManager_(inputManager)
@@ -18,7 +22,7 @@ DebugRenderSystem::DebugRenderSystem(SDL_Renderer* renderer, engine::input::Inpu
     }
 
 void DebugRenderSystem::Init() {
-    std::cout << "[DebugRenderSystem] Initialized - Press F1 to toggle debug mode" << std::endl;
+    LOG_INFO("DebugRenderSystem") << "Initialized - Press F1 to toggle debug mode";
 }
 
 void DebugRenderSystem::Update(float deltaTime) {
@@ -34,18 +38,20 @@ void DebugRenderSystem::Update(float deltaTime) {
 }
 
 void DebugRenderSystem::Shutdown() {
-    std::cout << "[DebugRenderSystem] Shutdown" << std::endl;
+    LOG_INFO("DebugRenderSystem") << "Shutdown";
     debugModeEnabled_ = false;
     f1KeyWasPressed_ = false;
 }
 
 void DebugRenderSystem::HandleInput() {
-    bool f1KeyCurrentlyPressed = inputManager_->IsKeyDown(SDLK_F1);
+    // Held state plus our own edge detection: the per-frame key-down flags
+    // are consumed by the first fixed tick, before render systems run
+    bool f1KeyCurrentlyPressed = inputManager_->IsKeyHeld(SDLK_F1);
 
     if (f1KeyCurrentlyPressed && !f1KeyWasPressed_) {
         debugModeEnabled_ = !debugModeEnabled_;
-        std::cout << "[DebugRenderSystem] Debug mode " 
-                  << (debugModeEnabled_ ? "ENABLED" : "DISABLED") << std::endl;
+        LOG_INFO("DebugRenderSystem") << "Debug mode " 
+                                      << (debugModeEnabled_ ? "ENABLED" : "DISABLED");
     }
 
     f1KeyWasPressed_ = f1KeyCurrentlyPressed;
@@ -87,7 +93,7 @@ void DebugRenderSystem::RenderMouseCoordinates() {
     // For now, keep console output for coordinates
     static int frameCounter = 0;
     if (frameCounter % 30 == 0) {
-        std::cout << "[DEBUG] Mouse: (" << mousePos.x << ", " << mousePos.y << ")" << std::endl;
+        LOG_DEBUG("DebugRenderSystem") << "Mouse: (" << mousePos.x << ", " << mousePos.y << ")";
     }
     frameCounter++;
 }
@@ -143,17 +149,10 @@ void DebugRenderSystem::RenderEntityInfo(EntityID entity, const Transform2D* tra
     SDL_RenderFillRect(renderer_, &centerDot);
     
     // TODO: Add text rendering for entity ID, coordinates, layer info
-    // For now, log to console periodically
-    static int logCounter = 0;
-    if (logCounter % 120 == 0) {  // Every 2 seconds at 60fps
-        std::cout << "[DEBUG] Entity " << entity 
-                  << " at (" << transform->x << ", " << transform->y << ")";
-        if (sprite) {
-            std::cout << " layer: " << sprite->renderLayer;
-        }
-        std::cout << std::endl;
-    }
-    logCounter++;
+    // For now, log periodically
+    LOG_DEBUG_EVERY("DebugRenderSystem", 2000) << "Entity " << entity 
+                                               << " at (" << transform->x << ", " << transform->y << ")"
+                                               << (sprite ? " layer: " + std::to_string(sprite->renderLayer) : "");
 }
 
 } // namespace engine::ECS
\ No newline at end of file
@@ -22,6 +22,8 @@ public:
     void Shutdown() override;
 
     const char* GetName() const override { return "DebugRenderSystem"; }
+    SystemAccess GetAccess() const override;
+    SystemPhase GetPhase() const override { return SystemPhase::Render; }
 
     bool IsDebugModeEnabled() const { return debugModeEnabled_; }
 
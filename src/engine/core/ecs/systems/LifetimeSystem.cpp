@@ -6,6 +6,10 @@
 
 namespace engine::ECS {
 
+SystemAccess LifetimeSystem::GetAccess() const {
+    return SystemAccess().Write<Lifetime>();
+}
+
 void LifetimeSystem::Update(float deltaTime) {
     auto* world = GetWorld();
 
@@ -14,21 +18,16 @@ void LifetimeSystem::Update(float deltaTime) {
     }
 
     auto& componentManager = world->GetComponentManager();
-    auto& EntityFactory = world->GetEntityFactory();
-
-    auto entities = componentManager.GetEntitiesWithComponent<Lifetime>();
 
-    for (EntityID entityId : entities) {
-        auto* lifetime = componentManager.GetComponent<Lifetime>(entityId);
-        if (lifetime) {
-            lifetime->remainingTime -= deltaTime;
+    // Expired entities are queued; the buffer is flushed after this system runs
+    for (auto [entityId, lifetime] : componentManager.GetView<Lifetime>()) {
+        lifetime.remainingTime -= deltaTime;
 
-            if (lifetime->remainingTime <= 0.0f) {
-                if (lifetime->destroyOnExpire) {
-                    EntityFactory.DestroyEntity(entityId);
-                } else {
-                    componentManager.RemoveComponent<Lifetime>(entityId);
-                }
+        if (lifetime.remainingTime <= 0.0f) {
+            if (lifetime.destroyOnExpire) {
+                commandBuffer_.DestroyEntity(entityId);
+            } else {
+                commandBuffer_.RemoveComponent<Lifetime>(entityId);
             }
         }
     }
@@ -11,6 +11,7 @@ class LifetimeSystem : public System {
 public:
     void Update(float deltaTime) override;
     const char* GetName() const override { return "LifetimeSystem"; }
+    SystemAccess GetAccess() const override;
 
 };
 } // namespace engine::ECS
\ No newline at end of file
@@ -3,30 +3,33 @@
 #include "ParticleSystem.hpp"
 #include "engine/core/ecs/World.hpp"
 #include "engine/core/ecs/components/Transform2D.hpp"
-#include "engine/core/ecs/components/Velocity2D.hpp"
-#include "engine/core/ecs/components/Sprite2D.hpp"
-#include "engine/core/ecs/components/ParticleComponent.hpp"
-#include "engine/core/ecs/components/ParticleEmitterComponent.hpp"
-#include <iostream>
+#include "engine/core/log/Logger.hpp"
+#include <algorithm>
 #include <cmath>
 
 namespace engine::ECS {
 
+SystemAccess ParticleSystem::GetAccess() const {
+    return SystemAccess()
+        .Write<ParticleEmitterComponent>()
+        .Read<Transform2D>();
+}
+
 ParticleSystem::ParticleSystem() : randomEngine_(std::random_device{}()) {
 }
 
 void ParticleSystem::Init() {
-    std::cout << "[ParticleSystem] Initialized" << std::endl;
+    LOG_INFO("ParticleSystem") << "Initialized";
 }
 
 void ParticleSystem::Update(float deltaTime) {
     UpdateEmitters(deltaTime);
     UpdateParticles(deltaTime);
-    CleanupDeadParticles();
+    CleanupFinishedEmitters();
 }
 
 void ParticleSystem::Shutdown() {
-    std::cout << "[ParticleSystem] Shutdown" << std::endl;
+    LOG_INFO("ParticleSystem") << "Shutdown";
 }
 
 void ParticleSystem::UpdateEmitters(float deltaTime) {
@@ -34,13 +37,12 @@ void ParticleSystem::UpdateEmitters(float deltaTime) {
     if (!world) return;
     
     auto& componentManager = world->GetComponentManager();
-    auto emitters = componentManager.GetEntitiesWithComponent<ParticleEmitterComponent>();
     
-    for (auto emitterId : emitters) {
-        auto* emitter = componentManager.GetComponent<ParticleEmitterComponent>(emitterId);
-        if (!emitter || !emitter->isActive) continue;
+    // Serial: emission draws from the shared random engine
+    for (auto [emitterId, emitter, transform] : componentManager.GetView<ParticleEmitterComponent, Transform2D>()) {
+        if (!emitter.isActive) continue;
         
-        EmitParticles(emitterId, deltaTime);
+        EmitParticles(emitter, Vector2{transform.x, transform.y}, deltaTime);
     }
 }
 
@@ -49,217 +51,112 @@ void ParticleSystem::UpdateParticles(float deltaTime) {
     if (!world) return;
     
     auto& componentManager = world->GetComponentManager();
-    auto particles = componentManager.GetEntitiesWithComponent<ParticleComponent>();
     
-    for (auto particleId : particles) {
-        auto* particle = componentManager.GetComponent<ParticleComponent>(particleId);
-        auto* transform = componentManager.GetComponent<Transform2D>(particleId);
-        auto* velocity = componentManager.GetComponent<Velocity2D>(particleId);
-        auto* sprite = componentManager.GetComponent<Sprite2D>(particleId);
-        
-        if (!particle || !transform) continue;
-        
-        // Update age
-        particle->age += deltaTime;
-        
-        // Check if particle should die
-        if (particle->age >= particle->lifetime) {
-            particle->isActive = false;
-            particlesToRemove_.push_back(particleId);
-            continue;
-        }
-        
-        // Calculate life progress (0 to 1)
-        float lifeProgress = particle->age / particle->lifetime;
-        
-        // Update velocity with acceleration
-        if (velocity) {
-            velocity->vx += particle->acceleration.x * deltaTime;
-            velocity->vy += particle->acceleration.y * deltaTime;
-        }
-        
-        // Update rotation
-        transform->rotation += particle->rotationSpeed * deltaTime;
-        
-        // Interpolate size
-        particle->currentSize = particle->startSize + 
-            (particle->endSize - particle->startSize) * lifeProgress;
-        // Use current size directly as scale factor
-        transform->scaleX = particle->currentSize;
-        transform->scaleY = particle->currentSize;
-        
-        // Interpolate color
-        if (sprite) {
-            particle->currentColor = InterpolateColor(
-                particle->startColor, 
-                particle->endColor, 
-                lifeProgress
-            );
-            sprite->tint = particle->currentColor;
-        }
-    }
+    // One emitter per chunk: each pool is a self-contained batch of work
+    componentManager.GetView<ParticleEmitterComponent>().ParallelForEach(world->GetJobSystem(),
+        [deltaTime](EntityID, ParticleEmitterComponent& emitter) {
+            emitter.particles.Update(deltaTime,
+                                     emitter.acceleration.x, emitter.acceleration.y,
+                                     emitter.startColor, emitter.endColor);
+            emitter.activeParticles = static_cast<int>(emitter.particles.Size());
+        }, 1);
 }
 
-void ParticleSystem::EmitParticles(EntityID emitterId, float deltaTime) {
-    auto* world = GetWorld();
-    if (!world) return;
-    
-    auto& componentManager = world->GetComponentManager();
-    auto* emitter = componentManager.GetComponent<ParticleEmitterComponent>(emitterId);
-    auto* emitterTransform = componentManager.GetComponent<Transform2D>(emitterId);
-    
-    if (!emitter || !emitterTransform) return;
+void ParticleSystem::EmitParticles(ParticleEmitterComponent& emitter, const Vector2& position, float deltaTime) {
+    // Pools are sized once; changing maxParticles later resizes (and empties) it
+    size_t capacity = static_cast<size_t>(std::max(emitter.maxParticles, 0));
+    if (emitter.particles.GetCapacity() != capacity) {
+        emitter.particles.SetCapacity(capacity);
+    }
     
-    if (emitter->isOneShot) {
+    if (emitter.isOneShot) {
         // Emit all particles at once
-        if (emitter->activeParticles == 0) {
-            for (int i = 0; i < emitter->burstCount && emitter->activeParticles < emitter->maxParticles; ++i) {
-                CreateParticle(emitterId, {emitterTransform->x, emitterTransform->y});
-                emitter->activeParticles++;
-            }
-            emitter->isActive = false; // Deactivate after burst
+        for (int i = 0; i < emitter.burstCount; ++i) {
+            if (!SpawnParticle(emitter, position)) break;
         }
+        emitter.isActive = false; // Deactivate after burst
     } else {
         // Continuous emission
-        emitter->emissionAccumulator += deltaTime;
-        float particlesToEmit = emitter->emissionRate * emitter->emissionAccumulator;
+        emitter.emissionAccumulator += deltaTime;
+        float particlesToEmit = emitter.emissionRate * emitter.emissionAccumulator;
         
-        while (particlesToEmit >= 1.0f && emitter->activeParticles < emitter->maxParticles) {
-            CreateParticle(emitterId, {emitterTransform->x, emitterTransform->y});
-            emitter->activeParticles++;
+        while (particlesToEmit >= 1.0f && !emitter.particles.Full()) {
+            SpawnParticle(emitter, position);
             particlesToEmit -= 1.0f;
-            emitter->emissionAccumulator -= 1.0f / emitter->emissionRate;
+            emitter.emissionAccumulator -= 1.0f / emitter.emissionRate;
         }
     }
+    emitter.activeParticles = static_cast<int>(emitter.particles.Size());
 }
 
-EntityID ParticleSystem::CreateParticle(EntityID emitterId, const Vector2& position) {
-    auto* world = GetWorld();
-    if (!world) return 0;
-    
-    auto& entityFactory = world->GetEntityFactory();
-    auto& componentManager = world->GetComponentManager();
-    
-    auto* emitter = componentManager.GetComponent<ParticleEmitterComponent>(emitterId);
-    if (!emitter) return 0;
-    
-    // Create particle entity
-    EntityID particleId = entityFactory.CreateEntity();
-    
-    // Add Transform2D
-    Transform2D transform;
-    transform.x = position.x;
-    transform.y = position.y;
-    transform.rotation = 0.0f;
-    transform.scaleX = 1.0f;
-    transform.scaleY = 1.0f;
-    componentManager.AddComponent<Transform2D>(particleId, transform);
-    
-    // Add ParticleComponent
-    ParticleComponent particle;
-    particle.lifetime = emitter->particleLifetime + 
-        GetRandomFloat(-emitter->lifetimeVariance, emitter->lifetimeVariance);
-    particle.age = 0.0f;
+bool ParticleSystem::SpawnParticle(ParticleEmitterComponent& emitter, const Vector2& position) {
+    ParticleSpawn spawn;
+    spawn.x = position.x;
+    spawn.y = position.y;
+    spawn.lifetime = emitter.particleLifetime + 
+        GetRandomFloat(-emitter.lifetimeVariance, emitter.lifetimeVariance);
     
     // Set velocity based on emitter shape
-    Vector2 baseVelocity = emitter->initialVelocity;
-    if (emitter->shape == EmitterShape::CONE) {
-        float angleRad = (emitter->coneDirection - emitter->coneAngle/2.0f + 
-                         GetRandomFloat(0, emitter->coneAngle)) * M_PI / 180.0f;
+    Vector2 baseVelocity = emitter.initialVelocity;
+    if (emitter.shape == EmitterShape::CONE) {
+        float angleRad = (emitter.coneDirection - emitter.coneAngle/2.0f + 
+                         GetRandomFloat(0, emitter.coneAngle)) * M_PI / 180.0f;
         float speed = std::sqrt(baseVelocity.x * baseVelocity.x + baseVelocity.y * baseVelocity.y);
         baseVelocity.x = std::cos(angleRad) * speed;
         baseVelocity.y = std::sin(angleRad) * speed;
     }
+    Vector2 velocity = GetRandomVector(baseVelocity, emitter.velocityVariance);
+    spawn.vx = velocity.x;
+    spawn.vy = velocity.y;
     
-    particle.velocity = GetRandomVector(baseVelocity, emitter->velocityVariance);
-    particle.acceleration = emitter->acceleration;
-    
-    particle.startSize = emitter->startSize + 
-        GetRandomFloat(-emitter->startSizeVariance, emitter->startSizeVariance);
-    particle.endSize = emitter->endSize + 
-        GetRandomFloat(-emitter->endSizeVariance, emitter->endSizeVariance);
-    particle.currentSize = particle.startSize;
-    
-    particle.startColor = emitter->startColor;
-    particle.endColor = emitter->endColor;
-    particle.currentColor = particle.startColor;
-    
-    particle.rotationSpeed = emitter->rotationSpeed + 
-        GetRandomFloat(-emitter->rotationSpeedVariance, emitter->rotationSpeedVariance);
+    spawn.startSize = emitter.startSize + 
+        GetRandomFloat(-emitter.startSizeVariance, emitter.startSizeVariance);
+    spawn.endSize = emitter.endSize + 
+        GetRandomFloat(-emitter.endSizeVariance, emitter.endSizeVariance);
     
-    componentManager.AddComponent<ParticleComponent>(particleId, particle);
+    spawn.rotationSpeed = emitter.rotationSpeed + 
+        GetRandomFloat(-emitter.rotationSpeedVariance, emitter.rotationSpeedVariance);
     
-    // Add Velocity2D
-    Velocity2D velocity;
-    velocity.vx = particle.velocity.x;
-    velocity.vy = particle.velocity.y;
-    velocity.maxSpeed = 1000.0f; // High max speed for particles
-    componentManager.AddComponent<Velocity2D>(particleId, velocity);
-    
-    // Add Sprite2D
-    Sprite2D sprite;
-    sprite.texturePath = emitter->particleTexture;
-    sprite.sourceRect = {0, 0, 0, 0}; // Use full texture (0,0,0,0 means use entire texture)
-    sprite.visible = true;
-    sprite.tint = particle.currentColor;
-    sprite.renderLayer = 15; // Above entities, below UI
-    sprite.pivotOffset = {0.5f, 0.5f}; // Center the particle
-    componentManager.AddComponent<Sprite2D>(particleId, sprite);
-    
-    std::cout << "[ParticleSystem] Created particle " << particleId 
-              << " at (" << position.x << ", " << position.y 
-              << ") with lifetime " << particle.lifetime << "s" 
-              << ", size " << particle.startSize << ", texture: " << sprite.texturePath << std::endl;
-    
-    return particleId;
+    return emitter.particles.Spawn(spawn, emitter.startColor);
 }
 
-void ParticleSystem::CleanupDeadParticles() {
+void ParticleSystem::CleanupFinishedEmitters() {
     auto* world = GetWorld();
     if (!world) return;
     
-    auto& entityFactory = world->GetEntityFactory();
     auto& componentManager = world->GetComponentManager();
     
-    for (auto particleId : particlesToRemove_) {
-        // Update emitter's active particle count
-        auto particles = componentManager.GetEntitiesWithComponent<ParticleEmitterComponent>();
-        for (auto emitterId : particles) {
-            auto* emitter = componentManager.GetComponent<ParticleEmitterComponent>(emitterId);
-            if (emitter && emitter->activeParticles > 0) {
-                emitter->activeParticles--;
-            }
+    for (auto [emitterId, emitter] : componentManager.GetView<ParticleEmitterComponent>()) {
+        if (emitter.isOneShot && !emitter.isActive && emitter.particles.Empty()) {
+            // Removes all components and destroys the entity on flush
+            commandBuffer_.DestroyEntity(emitterId);
         }
-        
-        // Remove all components and destroy entity
-        componentManager.RemoveAllComponents(particleId);
-        entityFactory.DestroyEntity(particleId);
     }
-    
-    particlesToRemove_.clear();
 }
 
 void ParticleSystem::CreateParticleBurst(const Vector2& position, int count, 
-                                       const SDL_Color& color, float speed) {
-    std::cout << "[ParticleSystem] Creating particle burst: " << count 
-              << " particles at (" << position.x << ", " << position.y << ")" << std::endl;
+                                       const SDL_Color& color, float speed,
+                                       CommandBuffer* commands) {
+    LOG_DEBUG("ParticleSystem") << "Creating particle burst: " << count 
+                               << " particles at (" << position.x << ", " << position.y << ")";
               
     auto* world = GetWorld();
     if (!world) {
-        std::cout << "[ParticleSystem] ERROR: No world available for particle burst" << std::endl;
+        LOG_ERROR("ParticleSystem") << "No world available for particle burst";
         return;
     }
     
-    auto& entityFactory = world->GetEntityFactory();
-    auto& componentManager = world->GetComponentManager();
+    // Usually called from another system's Update(), so record into that
+    // system's buffer rather than ours
+    CommandBuffer& buffer = commands ? *commands : world->GetCommandBuffer();
     
     // Create temporary emitter for burst
-    EntityID emitterId = entityFactory.CreateEntity();
+    EntityID emitterId = buffer.CreateEntity();
     
     Transform2D transform;
     transform.x = position.x;
     transform.y = position.y;
-    componentManager.AddComponent<Transform2D>(emitterId, transform);
+    buffer.AddComponent<Transform2D>(emitterId, transform);
     
     ParticleEmitterComponent emitter;
     emitter.isOneShot = true;
@@ -277,7 +174,7 @@ void ParticleSystem::CreateParticleBurst(const Vector2& position, int count,
     emitter.endSize = 0.05f;
     emitter.acceleration = {0, 100}; // Gravity
     
-    componentManager.AddComponent<ParticleEmitterComponent>(emitterId, emitter);
+    buffer.AddComponent<ParticleEmitterComponent>(emitterId, emitter);
 }
 
 float ParticleSystem::GetRandomFloat(float min, float max) {
@@ -291,13 +188,4 @@ Vector2 ParticleSystem::GetRandomVector(const Vector2& base, float variance) {
     };
 }
 
-SDL_Color ParticleSystem::InterpolateColor(const SDL_Color& start, const SDL_Color& end, float t) {
-    return {
-        static_cast<Uint8>(start.r + (end.r - start.r) * t),
-        static_cast<Uint8>(start.g + (end.g - start.g) * t),
-        static_cast<Uint8>(start.b + (end.b - start.b) * t),
-        static_cast<Uint8>(start.a + (end.a - start.a) * t)
-    };
-}
-
 } // namespace engine::ECS
\ No newline at end of file
@@ -3,13 +3,16 @@
 #pragma once
 
 #include "engine/core/ecs/System.hpp"
+#include "engine/core/ecs/components/ParticleEmitterComponent.hpp"
 #include "engine/core/Types.hpp"
 #include <SDL3/SDL.h>
 #include <random>
-#include <vector>
 
 namespace engine::ECS {
 
+// Particles live in a fixed-capacity ParticlePool inside each emitter rather
+// than as entities: emission and aging touch flat arrays only, and
+// RenderSystem draws each pool as one batch.
 class ParticleSystem : public System {
 public:
     ParticleSystem();
@@ -20,26 +23,29 @@ public:
     void Shutdown() override;
     
     const char* GetName() const override { return "ParticleSystem"; }
+    SystemAccess GetAccess() const override;
     
-    // Create a burst of particles at a position
+    // Create a burst of particles at a position. The emitter entity is queued on
+    // `commands` (the calling system's buffer) or, if null, the world's buffer.
     void CreateParticleBurst(const Vector2& position, int count, 
-                           const SDL_Color& color, float speed = 100.0f);
+                           const SDL_Color& color, float speed = 100.0f,
+                           CommandBuffer* commands = nullptr);
     
 private:
-    // Update all particle emitters
+    // Emit new particles from every active emitter
     void UpdateEmitters(float deltaTime);
     
-    // Update individual particles
+    // Step every emitter's particle pool
     void UpdateParticles(float deltaTime);
     
     // Emit new particles from an emitter
-    void EmitParticles(EntityID emitterId, float deltaTime);
+    void EmitParticles(ParticleEmitterComponent& emitter, const Vector2& position, float deltaTime);
     
-    // Create a single particle
-    EntityID CreateParticle(EntityID emitterId, const Vector2& position);
+    // Spawn a single particle into the emitter's pool
+    bool SpawnParticle(ParticleEmitterComponent& emitter, const Vector2& position);
     
-    // Clean up dead particles
-    void CleanupDeadParticles();
+    // Destroy one-shot emitters whose particles have all died
+    void CleanupFinishedEmitters();
     
     // Helper to get random float in range
     float GetRandomFloat(float min, float max);
@@ -47,15 +53,9 @@ private:
     // Helper to get random vector with variance
     Vector2 GetRandomVector(const Vector2& base, float variance);
     
-    // Interpolate between colors
-    SDL_Color InterpolateColor(const SDL_Color& start, const SDL_Color& end, float t);
-    
 private:
     std::mt19937 randomEngine_;
     std::uniform_real_distribution<float> randomDist_{0.0f, 1.0f};
-    
-    // Track particles for cleanup
-    std::vector<EntityID> particlesToRemove_;
 };
 
 } // namespace engine::ECS
\ No newline at end of file
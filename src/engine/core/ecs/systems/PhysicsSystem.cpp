@@ -12,8 +12,17 @@
 
 namespace engine::ECS {
 
+SystemAccess PhysicsSystem::GetAccess() const {
+    return SystemAccess().Read<PhysicsModeComponent>().Write<Transform2D>().Write<Velocity2D>();
+}
+
 void PhysicsSystem::Init() {
     if (auto* world = GetWorld()) {
+        auto& componentManager = world->GetComponentManager();
+        transforms_ = componentManager.GetComponentStore<Transform2D>();
+        velocities_ = componentManager.GetComponentStore<Velocity2D>();
+        physicsModes_ = componentManager.GetComponentStore<PhysicsModeComponent>();
+
         auto& eventManager = world->GetEventManager(); // Here we get event manager, maybe InputManager can use this pattern too to avoid direct assignment in world?
         eventManager.Subscribe(engine::event::EventType::COLLISION_STARTED, this);
     }
@@ -21,33 +30,30 @@ void PhysicsSystem::Init() {
 
 void PhysicsSystem::Update(float deltaTime) {
     auto* world = GetWorld();
-    if (!world) return;
+    if (!world || !transforms_) return;
     
-    auto& componentManager = world->GetComponentManager();
-    auto entities = componentManager.GetEntitiesWithComponents<Transform2D, Velocity2D>();
+    View<Transform2D, Velocity2D, PhysicsModeComponent> view(transforms_, velocities_, physicsModes_);
     
-    // Use references to avoid unnecessary copying
-    for (const EntityID& entityId : entities) {
-        auto* transform = componentManager.GetComponent<Transform2D>(entityId);
-        auto* velocity = componentManager.GetComponent<Velocity2D>(entityId);
-        auto* physicsMode = componentManager.GetComponent<PhysicsModeComponent>(entityId);
-        
-        if (!transform || !velocity || !physicsMode) continue;
-
-        // Apply physics updates
-        if (physicsMode->enableGravity) {
-            ApplyGravity(velocity, physicsMode, deltaTime);
-        }
-
-        if (physicsMode->enableFriction) {
-            ApplyFriction(velocity, physicsMode, deltaTime);
-        }
-
-        LimitVelocity(velocity);
-
-        transform->x += velocity->vx * deltaTime;
-        transform->y += velocity->vy * deltaTime;
-    }
+    // Each entity only touches its own components, so chunks run independently
+    view.ParallelForEach(world->GetJobSystem(),
+        [this, deltaTime](EntityID entityId, Transform2D& transform, Velocity2D& velocity, PhysicsModeComponent& physicsMode) {
+            // Apply physics updates
+            if (physicsMode.enableGravity) {
+                ApplyGravity(&velocity, &physicsMode, deltaTime);
+            }
+
+            if (physicsMode.enableFriction) {
+                ApplyFriction(&velocity, &physicsMode, deltaTime);
+            }
+
+            LimitVelocity(&velocity);
+
+            if (velocity.vx != 0.0f || velocity.vy != 0.0f) {
+                transform.x += velocity.vx * deltaTime;
+                transform.y += velocity.vy * deltaTime;
+                transforms_->MarkChanged(entityId);  // Only this entity's slot; safe per chunk
+            }
+        });
 }
 
 void PhysicsSystem::ApplyGravity(Velocity2D* velocity, const PhysicsModeComponent* mode, float deltaTime) {
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "engine/core/ecs/System.hpp"
+#include "engine/core/ecs/ComponentStore.hpp"
 #include "engine/core/ecs/components/Velocity2D.hpp"
 #include "engine/core/ecs/components/PhysicsMode.hpp"
 #include "engine/core/ecs/components/Transform2D.hpp"
@@ -28,6 +29,7 @@ public:
     void Init() override;
     void Update(float deltaTime) override;
     const char* GetName() const override { return "PhysicsSystem"; }
+    SystemAccess GetAccess() const override;
     
     // EventListener interface
     void onEvent(const std::shared_ptr<engine::event::Event>& event) override;
@@ -46,6 +48,10 @@ private:
     
     void HandleCollisionEvent(const engine::event::Event& event);
     
+    ComponentStore<Transform2D>* transforms_ = nullptr;
+    ComponentStore<Velocity2D>* velocities_ = nullptr;
+    ComponentStore<PhysicsModeComponent>* physicsModes_ = nullptr;
+
     std::unordered_map<std::string, CollisionResponseCallBack> collisionCallbacks_;
     std::unordered_map<EntityID, std::string> entityCollisionGroups_;
 };
@@ -1,27 +1,49 @@
 #include "RenderSystem.hpp"
 #include "engine/core/ecs/World.hpp"
 #include "engine/graphics/renderer/Renderer.hpp"
+#include "engine/core/profiling/TraceProfiler.hpp"
+#include "engine/core/log/Logger.hpp"
 #include <algorithm>
-#include <iostream>
+#include <cmath>
 #include <iomanip>
 
 namespace engine::ECS {
 
+SystemAccess RenderSystem::GetAccess() const {
+    // Writes Sprite2D and emitters only to cache resolved texture handles
+    return SystemAccess().Read<Transform2D>().Write<Sprite2D>().Write<ParticleEmitterComponent>().MainThread();
+}
+
 RenderSystem::RenderSystem(engine::graphics::SpriteRenderer* spriteRenderer, 
                            engine::resources::ResourceManager* resourceManager,
                            engine::graphics::Renderer* renderer)
     : spriteRenderer_(spriteRenderer)
     , resourceManager_(resourceManager)
     , renderer_(renderer)
+    , spriteBatch_(renderer ? renderer->GetSDLRenderer() : nullptr)
     , renderedSpriteCount_(0) {
 }
 
 void RenderSystem::Init() {
-    std::cout << "[RenderSystem] Initialized with layered rendering support" << std::endl;
+    if (world_) {
+        auto& componentManager = world_->GetComponentManager();
+        transforms_ = componentManager.GetComponentStore<Transform2D>();
+        sprites_ = componentManager.GetComponentStore<Sprite2D>();
+        emitters_ = componentManager.GetComponentStore<ParticleEmitterComponent>();
+        
+        // Losing either component takes the entity out of the cull index
+        auto onRemove = [this](EntityID entityId, auto&) { RemoveFromCullIndex(entityId); };
+        transformRemoveObserver_ = transforms_->AddObserver(ComponentEvent::Remove, onRemove);
+        spriteRemoveObserver_ = sprites_->AddObserver(ComponentEvent::Remove, onRemove);
+    }
+    LOG_INFO("RenderSystem") << "Initialized with layered rendering support";
 }
 
 void RenderSystem::Update(float deltaTime) {
-    if (!world_ || !spriteRenderer_ || !resourceManager_) {
+    if (!world_ || !transforms_ || !spriteRenderer_ || !resourceManager_) {
+        return;
+    }
+    if (renderer_->IsHeadless()) {
         return;
     }
 
@@ -29,21 +51,25 @@ void RenderSystem::Update(float deltaTime) {
 
     renderedSpriteCount_ = 0;
     
-    // Collect all renderable sprites
-    std::vector<RenderableSprite> renderables;
-    CollectRenderableSprites(renderables);
-    
-    // Sort by renderLayer (higher values render later, displayed on top)
-    std::sort(renderables.begin(), renderables.end());
+    // Collect all renderable sprites, then order them by layer, depth and texture
+    CollectRenderableSprites();
+    renderQueue_.Sort();
     
     // Render all sprites in order
-    for (const auto& renderable : renderables) {
-        RenderSprite(renderable);
+    spriteBatch_.Begin();
+    for (const auto& item : renderQueue_.GetItems()) {
+        const RenderableSprite& renderable = renderables_[item.index];
+        if (renderable.emitter) {
+            RenderParticles(renderable);
+        } else {
+            RenderSprite(renderable);
+        }
     }
+    spriteBatch_.End();
     
     #ifdef DEBUG
     if (renderedSpriteCount_ > 0) {
-        std::cout << "[RenderSystem] Rendered " << renderedSpriteCount_ << " sprites" << std::endl;
+        LOG_DEBUG("RenderSystem") << "Rendered " << renderedSpriteCount_ << " sprites";
     }
     #endif
 
@@ -51,7 +77,15 @@ void RenderSystem::Update(float deltaTime) {
 }
 
 void RenderSystem::Shutdown() {
-    std::cout << "[RenderSystem] Shutdown" << std::endl;
+    LOG_INFO("RenderSystem") << "Shutdown";
+    if (transforms_ && transformRemoveObserver_) {
+        transforms_->RemoveObserver(transformRemoveObserver_);
+    }
+    if (sprites_ && spriteRemoveObserver_) {
+        sprites_->RemoveObserver(spriteRemoveObserver_);
+    }
+    transformRemoveObserver_ = spriteRemoveObserver_ = 0;
+    DisableViewCulling();
     renderedSpriteCount_ = 0;
 }
 
@@ -67,45 +101,364 @@ void RenderSystem::SetGameWorldViewport(float offsetX, float offsetY, float widt
     useGameWorldViewport_ = true;
 }
 
-void RenderSystem::CollectRenderableSprites(std::vector<RenderableSprite>& renderables) {
-    auto& componentManager = world_->GetComponentManager();
-    auto entities = componentManager.GetEntitiesWithComponents<Transform2D, Sprite2D>();
+void RenderSystem::EnableViewCulling(const SDL_FRect& worldBounds, float cellSize) {
+    cullIndex_ = SpatialPartitionFactory::CreateGrid(cellSize, worldBounds);
+    cullWorldBounds_ = worldBounds;
+    cullIndexSynced_ = false;
+    LOG_INFO("RenderSystem") << "View culling enabled over " << worldBounds.w << "x" << worldBounds.h
+                             << " world, cell size " << cellSize;
+}
+
+void RenderSystem::DisableViewCulling() {
+    cullIndex_.reset();
+    cullIndexSynced_ = false;
+    cullEntries_.clear();
+    alwaysVisible_.clear();
+}
+
+void RenderSystem::CapturePreviousTransforms() {
+    if (!transforms_) {
+        return;
+    }
+    transforms_->ForEach([this](EntityID entityId, const Transform2D& transform) {
+        uint32_t index = GetEntityIndex(entityId);
+        if (index >= previousTransforms_.size()) {
+            previousTransforms_.resize(index + 1);
+        }
+        previousTransforms_[index] = {entityId, transform};
+    });
+}
+
+Transform2D RenderSystem::Interpolate(EntityID entityId, const Transform2D& current) const {
+    uint32_t index = GetEntityIndex(entityId);
+    if (interpolationAlpha_ >= 1.0f || index >= previousTransforms_.size() ||
+        previousTransforms_[index].entityId != entityId) {
+        return current;
+    }
     
-    renderables.reserve(entities.size());
+    const Transform2D& previous = previousTransforms_[index].transform;
+    float t = interpolationAlpha_;
+    Transform2D result = current;
+    result.x = previous.x + (current.x - previous.x) * t;
+    result.y = previous.y + (current.y - previous.y) * t;
+    // Shortest way around, so wrapping from +pi to -pi doesn't spin
+    result.rotation = previous.rotation + std::remainder(current.rotation - previous.rotation, 2.0f * static_cast<float>(M_PI)) * t;
+    result.scaleX = previous.scaleX + (current.scaleX - previous.scaleX) * t;
+    result.scaleY = previous.scaleY + (current.scaleY - previous.scaleY) * t;
+    return result;
+}
+
+bool RenderSystem::IsClipped(int renderLayer) const {
+    // UI elements (renderLayer >= 20) ignore the game world viewport
+    return useGameWorldViewport_ && renderLayer < 20;
+}
+
+const resources::TextureRegion* RenderSystem::ResolveRegion(resources::TextureHandle& handle, const std::string& path) {
+    if (const resources::TextureRegion* region = resourceManager_->GetTextureRegion(handle)) {
+        return region;
+    }
+    // Already looked up and not loaded, and nothing has loaded since
+    uint32_t loadEpoch = resourceManager_->GetTextureLoadEpoch();
+    if (handle.IsMissingAsOf(loadEpoch)) {
+        return nullptr;
+    }
+    // New sprite, or its texture was reloaded: resolve the path once
+    handle = resourceManager_->GetTextureHandle(path);
+    if (!handle.IsValid()) {
+        handle = resources::TextureHandle::Missing(loadEpoch);
+        return nullptr;
+    }
+    return resourceManager_->GetTextureRegion(handle);
+}
+
+void RenderSystem::CollectRenderableSprites() {
+    PROFILE_SCOPE("RenderSystem::CollectRenderableSprites");
+
+    renderables_.clear();
+    renderQueue_.Clear();
     
-    for (EntityID entityId : entities) {
-        auto* transform = componentManager.GetComponent<Transform2D>(entityId);
-        auto* sprite = componentManager.GetComponent<Sprite2D>(entityId);
+    if (!IsCullingActive()) {
+        cullIndexSynced_ = false;  // Not maintained meanwhile; rebuild on return
         
-        // Only collect visible sprites
-        if (transform && sprite && sprite->visible) {
-            renderables.push_back({entityId, transform, sprite});
+        View<Transform2D, Sprite2D> view(transforms_, sprites_);
+        renderables_.reserve(view.SizeHint());
+        renderQueue_.Reserve(view.SizeHint());
+        for (auto [entityId, current, sprite] : view) {
+            AddRenderable(entityId, current, sprite);
+        }
+        CollectParticleEmitters();
+        return;
+    }
+    
+    SyncCullIndex();
+    
+    // Game world coordinates of the viewport (see RenderSprite)
+    SDL_FRect viewRect = {
+        -CULL_MARGIN,
+        -CULL_MARGIN,
+        gameWorldWidth_ + CULL_MARGIN * 2.0f,
+        gameWorldHeight_ + CULL_MARGIN * 2.0f
+    };
+    visibleCandidates_.clear();
+    cullIndex_->Query(viewRect, visibleCandidates_);
+    for (EntityID entityId : visibleCandidates_) {
+        Transform2D* transform = transforms_->Get(entityId);
+        Sprite2D* sprite = sprites_->Get(entityId);
+        if (transform && sprite) {
+            AddRenderable(entityId, *transform, *sprite);
+        }
+    }
+    for (EntityID entityId : alwaysVisible_) {
+        Transform2D* transform = transforms_->Get(entityId);
+        Sprite2D* sprite = sprites_->Get(entityId);
+        if (transform && sprite) {
+            AddRenderable(entityId, *transform, *sprite);
         }
     }
+    // Pools are few and each is one batch; not culled
+    CollectParticleEmitters();
 }
 
-void RenderSystem::RenderSprite(const RenderableSprite& renderable) {
-    SDL_Texture* texture = resourceManager_->GetTexture(renderable.sprite->texturePath);
-    if (!texture) {
+void RenderSystem::CollectParticleEmitters() {
+    if (!emitters_) {
+        return;
+    }
+    for (auto [entityId, emitter] : View<ParticleEmitterComponent>(emitters_)) {
+        if (emitter.particles.Empty()) {
+            continue;
+        }
+        const resources::TextureRegion* region = ResolveRegion(emitter.texture, emitter.particleTexture);
+        if (!region) {
+            continue;
+        }
+        uint64_t key = engine::graphics::RenderQueue::MakeKey(
+            emitter.renderLayer, IsClipped(emitter.renderLayer), 0.0f, emitter.texture.index, GetEntityIndex(entityId));
+        renderQueue_.Push(key, static_cast<uint32_t>(renderables_.size()));
+        renderables_.push_back({entityId, Transform2D{}, nullptr, region,
+                                static_cast<float>(region->rect.w), static_cast<float>(region->rect.h), &emitter});
+    }
+}
+
+void RenderSystem::AddRenderable(EntityID entityId, const Transform2D& current, Sprite2D& sprite) {
+    // Only collect visible sprites
+    if (!sprite.visible) {
         return;
     }
     
-    // Calculate rendering parameters
-    Transform2D* transform = renderable.transform;
-    Sprite2D* sprite = renderable.sprite;
+    const resources::TextureRegion* region = ResolveRegion(sprite.texture, sprite.texturePath);
+    if (!region) {
+        return;
+    }
+    
+    Transform2D transform = Interpolate(entityId, current);
     
     // Determine sprite dimensions
-    float spriteWidth, spriteHeight;
-    if (sprite->sourceRect.w > 0 && sprite->sourceRect.h > 0) {
-        spriteWidth = sprite->sourceRect.w * transform->scaleX;
-        spriteHeight = sprite->sourceRect.h * transform->scaleY;
+    bool hasSourceRect = sprite.sourceRect.w > 0 && sprite.sourceRect.h > 0;
+    float width = (hasSourceRect ? sprite.sourceRect.w : region->rect.w) * transform.scaleX;
+    float height = (hasSourceRect ? sprite.sourceRect.h : region->rect.h) * transform.scaleY;
+    
+    // Within a game world layer, sprites whose bottom edge is lower on
+    // screen draw on top (y-sort). UI within a layer is ordered by entity
+    // index: stable per entity across frames, but not creation order, since
+    // indices are recycled. Overlapping UI should use separate layers.
+    bool isUIElement = sprite.renderLayer >= 20;
+    float depth = 0.0f;
+    uint32_t texture = 0;
+    if (!isUIElement) {
+        float pivotY = sprite.pivotOffset.y >= 0.0f ? sprite.pivotOffset.y : 0.0f;
+        depth = transform.y + height * (1.0f - pivotY);
+        texture = sprite.texture.index;
+    }
+    
+    uint64_t key = engine::graphics::RenderQueue::MakeKey(
+        sprite.renderLayer, IsClipped(sprite.renderLayer), depth, texture, GetEntityIndex(entityId));
+    renderQueue_.Push(key, static_cast<uint32_t>(renderables_.size()));
+    renderables_.push_back({entityId, transform, &sprite, region, width, height});
+}
+
+void RenderSystem::SyncCullIndex() {
+    PROFILE_SCOPE("RenderSystem::SyncCullIndex");
+
+    View<Transform2D, Sprite2D> view(transforms_, sprites_);
+    if (!cullIndexSynced_) {
+        cullIndex_->Clear();
+        cullEntries_.clear();
+        alwaysVisible_.clear();
+        for (auto [entityId, transform, sprite] : view) {
+            PlaceInCullIndex(entityId, transform, sprite);
+        }
+        cullIndexSynced_ = true;
+        return;
+    }
+    
+    // Only what moved, resized or was added since the last frame; rotation
+    // alone doesn't change the bounds
+    ChangeTick since = GetLastRunTick();
+    for (auto [entityId, transform, sprite] : view.Changed<Transform2D>(since)) {
+        PlaceInCullIndex(entityId, transform, sprite);
+    }
+    for (auto [entityId, transform, sprite] : view.Changed<Sprite2D>(since)) {
+        PlaceInCullIndex(entityId, transform, sprite);
+    }
+}
+
+void RenderSystem::PlaceInCullIndex(EntityID entityId, const Transform2D& transform, Sprite2D& sprite) {
+    uint32_t index = GetEntityIndex(entityId);
+    if (index >= cullEntries_.size()) {
+        cullEntries_.resize(index + 1);
+    }
+    CullEntry& entry = cullEntries_[index];
+    if (entry.entityId != entityId) {
+        RemoveFromCullIndex(entry.entityId);
+        entry.entityId = entityId;
+    }
+    
+    SDL_FRect bounds;
+    bool indexable = sprite.renderLayer < 20 &&
+                     ComputeCullBounds(transform, sprite, bounds) &&
+                     bounds.x >= cullWorldBounds_.x &&
+                     bounds.y >= cullWorldBounds_.y &&
+                     bounds.x + bounds.w <= cullWorldBounds_.x + cullWorldBounds_.w &&
+                     bounds.y + bounds.h <= cullWorldBounds_.y + cullWorldBounds_.h;
+    if (indexable) {
+        cullIndex_->Update(entityId, bounds);
+        entry.indexed = true;
+        SetAlwaysVisible(entry, false);
     } else {
-        float textureWidth, textureHeight;
-        SDL_GetTextureSize(texture, &textureWidth, &textureHeight);
-        spriteWidth = textureWidth * transform->scaleX;
-        spriteHeight = textureHeight * transform->scaleY;
+        if (entry.indexed) {
+            cullIndex_->Remove(entityId);
+            entry.indexed = false;
+        }
+        SetAlwaysVisible(entry, true);
+    }
+}
+
+void RenderSystem::RemoveFromCullIndex(EntityID entityId) {
+    uint32_t index = GetEntityIndex(entityId);
+    if (!cullIndex_ || entityId == INVALID_ENTITY || index >= cullEntries_.size()) {
+        return;
+    }
+    CullEntry& entry = cullEntries_[index];
+    if (entry.entityId != entityId) {
+        return;
+    }
+    if (entry.indexed) {
+        cullIndex_->Remove(entityId);
+    }
+    SetAlwaysVisible(entry, false);
+    entry = CullEntry{};
+}
+
+void RenderSystem::SetAlwaysVisible(CullEntry& entry, bool alwaysVisible) {
+    bool listed = entry.alwaysVisibleSlot != NOT_LISTED;
+    if (alwaysVisible == listed) {
+        return;
+    }
+    if (alwaysVisible) {
+        entry.alwaysVisibleSlot = static_cast<uint32_t>(alwaysVisible_.size());
+        alwaysVisible_.push_back(entry.entityId);
+        return;
+    }
+    // Swap-remove, repointing the entry that moved into the hole
+    uint32_t slot = entry.alwaysVisibleSlot;
+    EntityID moved = alwaysVisible_.back();
+    alwaysVisible_[slot] = moved;
+    alwaysVisible_.pop_back();
+    cullEntries_[GetEntityIndex(moved)].alwaysVisibleSlot = slot;
+    entry.alwaysVisibleSlot = NOT_LISTED;
+}
+
+bool RenderSystem::ComputeCullBounds(const Transform2D& transform, Sprite2D& sprite, SDL_FRect& bounds) {
+    const resources::TextureRegion* region = ResolveRegion(sprite.texture, sprite.texturePath);
+    if (!region) {
+        return false;
+    }
+    bool hasSourceRect = sprite.sourceRect.w > 0 && sprite.sourceRect.h > 0;
+    float width = std::fabs((hasSourceRect ? sprite.sourceRect.w : region->rect.w) * transform.scaleX);
+    float height = std::fabs((hasSourceRect ? sprite.sourceRect.h : region->rect.h) * transform.scaleY);
+    
+    // Circle around the rotation point that holds the sprite at any angle.
+    // With a pivot the transform is the pivot; otherwise it's the top-left
+    // corner and rotation is about the center.
+    float centerX, centerY, reachX, reachY;
+    if (sprite.pivotOffset.x >= 0.0f && sprite.pivotOffset.y >= 0.0f) {
+        centerX = transform.x;
+        centerY = transform.y;
+        reachX = width * std::max(sprite.pivotOffset.x, 1.0f - sprite.pivotOffset.x);
+        reachY = height * std::max(sprite.pivotOffset.y, 1.0f - sprite.pivotOffset.y);
+    } else {
+        centerX = transform.x + width * 0.5f;
+        centerY = transform.y + height * 0.5f;
+        reachX = width * 0.5f;
+        reachY = height * 0.5f;
+    }
+    float radius = std::sqrt(reachX * reachX + reachY * reachY);
+    bounds = {centerX - radius, centerY - radius, radius * 2.0f, radius * 2.0f};
+    return true;
+}
+
+void RenderSystem::RenderParticles(const RenderableSprite& renderable) {
+    PROFILE_SCOPE("RenderSystem::RenderParticles");
+
+    const ParticleEmitterComponent* emitter = renderable.emitter;
+    const ParticlePool::Data& data = emitter->particles.GetData();
+    const resources::TextureRegion* region = renderable.region;
+    
+    engine::graphics::SpriteBatch::QuadArrays quads;
+    quads.count = emitter->particles.Size();
+    quads.x = data.x.data();
+    quads.y = data.y.data();
+    quads.previousX = data.previousX.data();
+    quads.previousY = data.previousY.data();
+    quads.alpha = interpolationAlpha_;
+    quads.scale = data.size.data();
+    quads.rotation = data.rotation.data();
+    quads.r = data.r.data();
+    quads.g = data.g.data();
+    quads.b = data.b.data();
+    quads.a = data.a.data();
+    
+    // Particles are in world space, like game world sprites
+    float offsetX = 0.0f, offsetY = 0.0f;
+    SDL_Rect* clipPtr = nullptr;
+    SDL_Rect clipRect;
+    if (IsClipped(emitter->renderLayer)) {
+        offsetX = gameWorldOffsetX_;
+        offsetY = gameWorldOffsetY_;
+        clipRect = {
+            static_cast<int>(gameWorldOffsetX_),
+            static_cast<int>(gameWorldOffsetY_),
+            static_cast<int>(gameWorldWidth_),
+            static_cast<int>(gameWorldHeight_)
+        };
+        clipPtr = &clipRect;
     }
     
+    SDL_FRect sourceRect = {
+        static_cast<float>(region->rect.x),
+        static_cast<float>(region->rect.y),
+        static_cast<float>(region->rect.w),
+        static_cast<float>(region->rect.h)
+    };
+    spriteBatch_.DrawQuads(region->texture, renderable.width, renderable.height,
+                           &sourceRect, quads, offsetX, offsetY, clipPtr);
+    
+    renderedSpriteCount_ += quads.count;
+}
+
+void RenderSystem::RenderSprite(const RenderableSprite& renderable) {
+    PROFILE_SCOPE("RenderSystem::RenderSprite");
+
+    // Calculate rendering parameters
+    const Transform2D* transform = &renderable.transform;
+    const Sprite2D* sprite = renderable.sprite;
+    const resources::TextureRegion* region = renderable.region;
+    SDL_Texture* texture = region->texture;
+    
+    bool hasSourceRect = sprite->sourceRect.w > 0 && sprite->sourceRect.h > 0;
+    float spriteWidth = renderable.width;
+    float spriteHeight = renderable.height;
+    
     // Apply game world viewport offset if enabled
     float renderX = transform->x;
     float renderY = transform->y;
@@ -143,10 +496,6 @@ void RenderSystem::RenderSprite(const RenderableSprite& renderable) {
         // UI elements use their original positions without viewport offset
     }
     
-    // Set color tinting
-    SDL_SetTextureColorMod(texture, sprite->tint.r, sprite->tint.g, sprite->tint.b);
-    SDL_SetTextureAlphaMod(texture, sprite->tint.a);
-    
     // Calculate pivot point if specified
     SDL_FPoint* pivotPtr = nullptr;
     SDL_FPoint calculatedPivot;
@@ -156,59 +505,49 @@ void RenderSystem::RenderSprite(const RenderableSprite& renderable) {
         pivotPtr = &calculatedPivot;
     }
     
+    // Game world sprites are clipped to the viewport; UI elements
+    // (renderLayer >= 20) are not
+    SDL_Rect* clipPtr = nullptr;
     SDL_Rect clipRect;
-    bool needsClipping = false;
-    
-    if (useGameWorldViewport_) {
-        // UI elements (renderLayer >= 20) are not clipped to game world
-        bool isUIElement = sprite->renderLayer >= 20;
-        
-        if (!isUIElement) {
-            clipRect = {
-                static_cast<int>(gameWorldOffsetX_),
-                static_cast<int>(gameWorldOffsetY_),
-                static_cast<int>(gameWorldWidth_),
-                static_cast<int>(gameWorldHeight_)
-            };
-            
-            auto* sdlRenderer = renderer_->GetSDLRenderer();
-            if (sdlRenderer) {
-                SDL_SetRenderClipRect(sdlRenderer, &clipRect);
-                needsClipping = true;
-            }
-        }
-        // UI elements render without clipping
+    if (IsClipped(sprite->renderLayer)) {
+        clipRect = {
+            static_cast<int>(gameWorldOffsetX_),
+            static_cast<int>(gameWorldOffsetY_),
+            static_cast<int>(gameWorldWidth_),
+            static_cast<int>(gameWorldHeight_)
+        };
+        clipPtr = &clipRect;
     }
     
-    // Prepare sourceRect for sprite sheet rendering
-    SDL_FRect* sourceRectPtr = nullptr;
+    // sourceRect is relative to the image; the image may sit anywhere in
+    // its texture (atlas page)
     SDL_FRect sourceRect;
-    if (sprite->sourceRect.w > 0 && sprite->sourceRect.h > 0) {
+    if (hasSourceRect) {
         sourceRect = {
-            static_cast<float>(sprite->sourceRect.x),
-            static_cast<float>(sprite->sourceRect.y),
+            static_cast<float>(region->rect.x + sprite->sourceRect.x),
+            static_cast<float>(region->rect.y + sprite->sourceRect.y),
             static_cast<float>(sprite->sourceRect.w),
             static_cast<float>(sprite->sourceRect.h)
         };
-        sourceRectPtr = &sourceRect;
-    }
-    
-    // Call SpriteRenderer for rendering
-    spriteRenderer_->Draw(texture, 
-                         renderX, renderY,
-                         spriteWidth, spriteHeight,
-                         transform->rotation,
-                         SDL_FLIP_NONE,
-                         pivotPtr,
-                         sourceRectPtr);
-    
-    if (needsClipping) {
-        auto* sdlRenderer = renderer_->GetSDLRenderer();
-        if (sdlRenderer) {
-            SDL_SetRenderClipRect(sdlRenderer, nullptr);
-        }
+    } else {
+        sourceRect = {
+            static_cast<float>(region->rect.x),
+            static_cast<float>(region->rect.y),
+            static_cast<float>(region->rect.w),
+            static_cast<float>(region->rect.h)
+        };
     }
     
+    // Consecutive sprites sharing texture and clip go out as one draw call
+    spriteBatch_.Draw(texture,
+                      renderX, renderY,
+                      spriteWidth, spriteHeight,
+                      transform->rotation,
+                      pivotPtr,
+                      &sourceRect,
+                      sprite->tint,
+                      clipPtr);
+    
     renderedSpriteCount_++;
 }
 
@@ -1,12 +1,19 @@
 #pragma once
 
 #include "engine/core/ecs/System.hpp"
+#include "engine/core/ecs/ComponentStore.hpp"
+#include "engine/core/ecs/EntityHandle.hpp"
 #include "engine/core/ecs/components/Transform2D.hpp"
 #include "engine/core/ecs/components/Sprite2D.hpp"
+#include "engine/core/ecs/components/ParticleEmitterComponent.hpp"
+#include "engine/core/ecs/spatial/SpatialPartition.hpp"
 #include "engine/graphics/sprite/SpriteRenderer.hpp"
+#include "engine/graphics/sprite/SpriteBatch.hpp"
+#include "engine/graphics/sprite/RenderQueue.hpp"
 #include "engine/graphics/renderer/Renderer.hpp"
 #include "engine/resource/ResourceManager.hpp"
 #include "engine/core/Types.hpp"
+#include <memory>
 #include <vector>
 
 namespace engine::ECS {
@@ -25,35 +32,106 @@ public:
     void Shutdown() override;
 
     const char* GetName() const override { return "RenderSystem"; }
+    SystemAccess GetAccess() const override;
+    SystemPhase GetPhase() const override { return SystemPhase::Render; }
+
+    // Fixed-timestep interpolation: the engine captures every Transform2D
+    // before each tick, then draws at alpha (0 = previous tick, 1 = current).
+    // Entities with nothing captured yet draw at their current transform.
+    void CapturePreviousTransforms();
+    void SetInterpolationAlpha(float alpha) { interpolationAlpha_ = alpha; }
+    float GetInterpolationAlpha() const { return interpolationAlpha_; }
 
     // 渲染统计信息
     size_t GetRenderedSpriteCount() const { return renderedSpriteCount_; }
+    size_t GetDrawCallCount() const { return spriteBatch_.GetDrawCallCount(); }
     void ResetStats();
     
     // 游戏世界视口设置
     void SetGameWorldViewport(float offsetX, float offsetY, float width, float height);
     void EnableGameWorldViewport(bool enabled) { useGameWorldViewport_ = enabled; }
+    
+    // View culling: game world sprites are kept in a spatial index over
+    // worldBounds (updated from Changed<Transform2D>/Changed<Sprite2D>), and
+    // only those near the viewport are collected. UI layers (renderLayer >= 20)
+    // and sprites outside worldBounds sit in an always-visible list. Applies
+    // while the game world viewport is enabled.
+    void EnableViewCulling(const SDL_FRect& worldBounds, float cellSize = DEFAULT_CULL_CELL_SIZE);
+    void DisableViewCulling();
+    bool IsViewCullingEnabled() const { return cullIndex_ != nullptr; }
+
+    static constexpr float DEFAULT_CULL_CELL_SIZE = 128.0f;
 
 private:
     struct RenderableSprite {
         EntityID entityId;
-        Transform2D* transform;
+        Transform2D transform;  // Interpolated
         Sprite2D* sprite;
-        
-        bool operator<(const RenderableSprite& other) const {
-            return sprite->renderLayer < other.sprite->renderLayer;
-        }
+        const resources::TextureRegion* region;
+        float width;   // Scaled
+        float height;
+        const ParticleEmitterComponent* emitter = nullptr;  // Set for a particle pool (sprite is null)
+    };
+
+    // Fills renderables_ and queues each with its sort key
+    void CollectRenderableSprites();
+    void AddRenderable(EntityID entityId, const Transform2D& current, Sprite2D& sprite);
+    void CollectParticleEmitters();
+    void RenderParticles(const RenderableSprite& renderable);
+    bool IsClipped(int renderLayer) const;
+    const resources::TextureRegion* ResolveRegion(resources::TextureHandle& handle, const std::string& path);
+
+    struct CullEntry {
+        EntityID entityId = INVALID_ENTITY;
+        bool indexed = false;                    // In cullIndex_
+        uint32_t alwaysVisibleSlot = NOT_LISTED; // Position in alwaysVisible_
     };
+    static constexpr uint32_t NOT_LISTED = UINT32_MAX;
+    // Query padding: covers interpolation lag and untracked rotation
+    static constexpr float CULL_MARGIN = 64.0f;
 
-    void CollectRenderableSprites(std::vector<RenderableSprite>& renderables);
+    bool IsCullingActive() const { return cullIndex_ && useGameWorldViewport_; }
+    void SyncCullIndex();
+    void PlaceInCullIndex(EntityID entityId, const Transform2D& transform, Sprite2D& sprite);
+    void RemoveFromCullIndex(EntityID entityId);
+    void SetAlwaysVisible(CullEntry& entry, bool alwaysVisible);
+    // Rotation-independent world bounds; false if the size isn't known yet
+    bool ComputeCullBounds(const Transform2D& transform, Sprite2D& sprite, SDL_FRect& bounds);
     void RenderSprite(const RenderableSprite& renderable);
+    Transform2D Interpolate(EntityID entityId, const Transform2D& current) const;
+
+    struct PreviousTransform {
+        EntityID entityId = INVALID_ENTITY;  // Detects reused indices
+        Transform2D transform;
+    };
 
     engine::graphics::SpriteRenderer* spriteRenderer_;
     engine::resources::ResourceManager* resourceManager_;
     engine::graphics::Renderer* renderer_;
+    engine::graphics::SpriteBatch spriteBatch_;
+    
+    // Reused every frame
+    std::vector<RenderableSprite> renderables_;
+    engine::graphics::RenderQueue renderQueue_;
+    
+    ComponentStore<Transform2D>* transforms_ = nullptr;
+    ComponentStore<Sprite2D>* sprites_ = nullptr;
+    ComponentStore<ParticleEmitterComponent>* emitters_ = nullptr;
     
     size_t renderedSpriteCount_ = 0;
     
+    std::unique_ptr<SpatialPartition> cullIndex_;
+    SDL_FRect cullWorldBounds_ = {0.0f, 0.0f, 0.0f, 0.0f};
+    bool cullIndexSynced_ = false;
+    std::vector<CullEntry> cullEntries_;  // By entity index
+    std::vector<EntityID> alwaysVisible_;
+    std::vector<EntityID> visibleCandidates_;  // Reused by the per-frame cull query
+    ObserverID transformRemoveObserver_ = 0;
+    ObserverID spriteRemoveObserver_ = 0;
+    
+    std::vector<PreviousTransform> previousTransforms_;  // By entity index
+    float interpolationAlpha_ = 1.0f;
+    
     bool useGameWorldViewport_ = false;
     float gameWorldOffsetX_ = 0.0f;
     float gameWorldOffsetY_ = 0.0f;
@@ -7,8 +7,8 @@
 #include "engine/core/ecs/components/Velocity2D.hpp"
 #include "engine/core/ecs/components/AnimationState.hpp"
 #include "examples/zombie_survivor/ecs/components/AimingComponent.hpp"
+#include "engine/core/log/Logger.hpp"
 #include <cmath>
-#include <iostream>
 
 namespace engine::ECS {
 
@@ -37,18 +37,13 @@ void SpriteStateSystem::Update(float deltaTime) {
         auto* aimingComponent = componentManager.GetComponent<ZombieSurvivor::Component::AimingComponent>(entityId);
         
         SpriteStateComponent::Direction newDirection;
-        static int directionDebugCount = 0;
         
         if (aimingComponent) {
             // Use aiming direction for entities that can aim (like players)
             newDirection = CalculateDirection(aimingComponent->aimDirection.x, aimingComponent->aimDirection.y);
-            
-            if (directionDebugCount < 10) {
-                std::cout << "*** [SpriteStateSystem] Entity " << entityId 
-                          << " using AIMING direction (" << aimingComponent->aimDirection.x 
-                          << "," << aimingComponent->aimDirection.y << ") ***" << std::endl;
-                directionDebugCount++;
-            }
+            LOG_DEBUG_EVERY("SpriteStateSystem", 2000) << "Entity " << entityId 
+                                                       << " using aiming direction (" << aimingComponent->aimDirection.x 
+                                                       << "," << aimingComponent->aimDirection.y << ")";
         } else if (velocity) {
             // Fallback to movement direction for entities without aiming (like zombies)
             newDirection = CalculateDirection(velocity->vx, velocity->vy);
@@ -88,13 +83,8 @@ SpriteStateComponent::Direction SpriteStateSystem::CalculateDirection(float vx,
     float angle = std::atan2(vy, vx) * 180.0f / M_PI;
     if (angle < 0) angle += 360.0f;
     
-    // Debug output (only first few times)
-    static int debugCount = 0;
-    if (debugCount < 5 && (std::abs(vx) > MOVEMENT_THRESHOLD || std::abs(vy) > MOVEMENT_THRESHOLD)) {
-        std::cout << "*** [SpriteStateSystem] Direction(" << vx << "," << vy 
-                  << ") -> Angle(" << angle << "°) ***" << std::endl;
-        debugCount++;
-    }
+    LOG_DEBUG_EVERY("SpriteStateSystem", 2000) << "Direction(" << vx << "," << vy 
+                                               << ") -> Angle(" << angle << "°)";
     
     // Convert angle to 8-directional movement
     // 0° = RIGHT, 90° = DOWN, 180° = LEFT, 270° = UP
@@ -133,14 +123,20 @@ void SpriteStateSystem::UpdateEntitySprite(EntityID entityId) {
     // Only update if sprite path changed
     if (sprite->texturePath != newSpritePath) {
         sprite->texturePath = newSpritePath;
+        sprite->texture = {};
+        componentManager.MarkChanged<Sprite2D>(entityId);  // Size may differ
         
-        // Preload the new texture
+        // Direction sprites are usually loaded already; only the first switch
+        // to a new path loads (and takes a reference)
         if (resourceManager_) {
-            resourceManager_->LoadTexture(newSpritePath);
+            sprite->texture = resourceManager_->GetTextureHandle(newSpritePath);
+            if (!sprite->texture.IsValid()) {
+                sprite->texture = resourceManager_->LoadTextureHandle(newSpritePath);
+            }
         }
         
-        std::cout << "[SpriteStateSystem] Entity " << entityId 
-                  << " switched to sprite: " << newSpritePath << std::endl;
+        LOG_DEBUG("SpriteStateSystem") << "Entity " << entityId 
+                                      << " switched to sprite: " << newSpritePath;
     }
 }
 
@@ -1,14 +1,15 @@
 #include "EventManager.hpp"
+#include "engine/core/profiling/TraceProfiler.hpp"
+#include "engine/core/log/Logger.hpp"
 #include <algorithm> // for std::find
-#include <iostream>
 
 namespace engine::event {
 
 void EventManager::Subscribe(EventType type, EventListener* listener) {
     std::lock_guard<std::mutex> lock(listenersMutex_);
     listeners_[type].insert(listener);
-    std::cout << "[EventManager] Subscribed listener for type " << (int)type 
-              << ", total listeners: " << listeners_[type].size() << std::endl;
+    LOG_INFO("EventManager") << "Subscribed listener for type " << (int)type 
+                             << ", total listeners: " << listeners_[type].size();
 }
 
 void EventManager::Unsubscribe(EventType type, EventListener* listener) {
@@ -104,6 +105,8 @@ void EventManager::ProcessEventsByPriority() {
 }
 
 void EventManager::ProcessEvent(const std::shared_ptr<Event>& event) {
+    PROFILE_SCOPE("EventManager::ProcessEvent");
+
     // Safe listener copy
     std::unordered_set<EventListener*> listenersCopy;
     {
@@ -133,9 +136,9 @@ void EventManager::ProcessEvent(const std::shared_ptr<Event>& event) {
             try {
                 listener->onEvent(event);
             } catch (const std::exception& e) {
-                std::cerr << "[EventManager] Listener threw exception: " << e.what() << std::endl;
+                LOG_ERROR("EventManager") << "Listener threw exception: " << e.what();
             } catch (...) {
-                std::cerr << "[EventManager] Listener threw unknown exception." << std::endl;
+                LOG_ERROR("EventManager") << "Listener threw unknown exception.";
             }
         }
     }
@@ -144,7 +147,7 @@ void EventManager::ProcessEvent(const std::shared_ptr<Event>& event) {
 void EventManager::SubscribeWithFilter(EventType type, EventListener* listener, 
                                      std::unique_ptr<EventFilter> filter) {
     if (!listener) {
-        std::cout << "[EventManager] Warning: Attempting to subscribe null listener!" << std::endl;
+        LOG_WARN("EventManager") << "Attempting to subscribe null listener!";
         return;
     }
     
@@ -155,13 +158,13 @@ void EventManager::SubscribeWithFilter(EventType type, EventListener* listener,
     if (filter) {
         std::lock_guard<std::mutex> lock(filtersMutex_);
         filters_[listener] = std::move(filter);
-        std::cout << "[EventManager] Added filter for listener" << std::endl;
+        LOG_INFO("EventManager") << "Added filter for listener";
     }
 }
 
 void EventManager::SubscribeToMultiple(const std::vector<EventType>& types, EventListener* listener) {
     if (!listener) {
-        std::cout << "[EventManager] Warning: Attempting to subscribe null listener!" << std::endl;
+        LOG_WARN("EventManager") << "Attempting to subscribe null listener!";
         return;
     }
 
@@ -172,7 +175,7 @@ void EventManager::SubscribeToMultiple(const std::vector<EventType>& types, Even
 
 void EventManager::SubscribeToMultipleWithFilter(const std::vector<EventType>& types, EventListener* listener, std::unique_ptr<EventFilter> filter) {
     if (!listener) {
-        std::cout << "[EventManager] Warning: Attempting to subscribe null listener!" << std::endl;
+        LOG_WARN("EventManager") << "Attempting to subscribe null listener!";
         return;
     }
 
@@ -181,7 +184,7 @@ void EventManager::SubscribeToMultipleWithFilter(const std::vector<EventType>& t
     if (filter) {
         std::lock_guard<std::mutex> lock(filtersMutex_);
         filters_[listener] = std::move(filter);
-        std::cout << "[EventManager] Added filter for multi-type listener" << std::endl;
+        LOG_INFO("EventManager") << "Added filter for multi-type listener";
     }
 
 }
@@ -0,0 +1,224 @@
+// src/engine/core/job/JobSystem.cpp
+
+#include "JobSystem.hpp"
+#include "engine/core/profiling/TraceProfiler.hpp"
+#include "engine/core/log/Logger.hpp"
+
+namespace engine::job {
+
+namespace {
+// Which queue the current thread owns, per JobSystem (workers only)
+thread_local const JobSystem* tlsOwner = nullptr;
+thread_local size_t tlsQueueIndex = 0;
+} // namespace
+
+JobSystem::JobSystem(size_t workerCount) {
+    Start(workerCount);
+}
+
+JobSystem::~JobSystem() {
+    Stop();
+}
+
+size_t JobSystem::DetectWorkerCount() {
+    unsigned int cores = std::thread::hardware_concurrency();
+    return cores > 1 ? cores - 1 : 0;
+}
+
+void JobSystem::SetWorkerCount(size_t workerCount) {
+    Stop();
+    Start(workerCount);
+}
+
+void JobSystem::Start(size_t workerCount) {
+    if (workerCount == AUTO_DETECT) {
+        workerCount = DetectWorkerCount();
+    }
+
+    stopping_ = false;
+    queues_.clear();
+    for (size_t i = 0; i <= workerCount; ++i) {
+        queues_.push_back(std::make_unique<WorkQueue>());
+    }
+    for (size_t i = 0; i < workerCount; ++i) {
+        workers_.emplace_back(&JobSystem::WorkerLoop, this, i + 1);
+    }
+
+    if (workerCount > 0) {
+        LOG_INFO("JobSystem") << "Started " << workerCount << " worker threads";
+    }
+}
+
+void JobSystem::Stop() {
+    if (workers_.empty()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+        stopping_ = true;
+    }
+    wakeWorkers_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+    workers_.clear();
+
+    // Anything still queued runs here so handles never dangle incomplete
+    while (TryRunOne()) {}
+}
+
+JobHandle JobSystem::Schedule(std::function<void()> fn) {
+    auto job = std::make_shared<detail::Job>();
+    job->fn = std::move(fn);
+    Submit(job);
+    return JobHandle(std::move(job));
+}
+
+JobHandle JobSystem::ScheduleAfter(const JobHandle& dependency, std::function<void()> fn) {
+    auto job = std::make_shared<detail::Job>();
+    job->fn = std::move(fn);
+
+    if (dependency.job_) {
+        std::lock_guard<std::mutex> lock(dependency.job_->mutex);
+        if (!dependency.job_->done.load(std::memory_order_relaxed)) {
+            // Submitted by whichever thread finishes the dependency
+            dependency.job_->continuations.push_back(job);
+            return JobHandle(std::move(job));
+        }
+    }
+    Submit(job);
+    return JobHandle(std::move(job));
+}
+
+void JobSystem::Wait(const JobHandle& handle) {
+    while (!handle.IsComplete()) {
+        if (!TryRunOne()) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void JobSystem::Submit(JobPtr job) {
+    if (IsSingleThreaded()) {
+        Execute(job);
+        return;
+    }
+
+    {
+        auto& queue = *queues_[CurrentQueueIndex()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.jobs.push_back(std::move(job));
+    }
+    queuedJobs_.fetch_add(1, std::memory_order_release);
+    {
+        // Pairs with the predicate check in WorkerLoop so the wakeup isn't lost
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+    }
+    wakeWorkers_.notify_one();
+}
+
+void JobSystem::Execute(const JobPtr& job) {
+    job->fn();
+    job->fn = nullptr;  // Release captures early
+
+    std::vector<JobPtr> continuations;
+    {
+        std::lock_guard<std::mutex> lock(job->mutex);
+        job->done.store(true, std::memory_order_release);
+        continuations.swap(job->continuations);
+    }
+    for (auto& continuation : continuations) {
+        Submit(std::move(continuation));
+    }
+}
+
+bool JobSystem::TryRunOne() {
+    JobPtr job = PopOrSteal(CurrentQueueIndex());
+    if (!job) {
+        return false;
+    }
+    Execute(job);
+    return true;
+}
+
+JobSystem::JobPtr JobSystem::PopOrSteal(size_t queueIndex) {
+    if (queuedJobs_.load(std::memory_order_acquire) == 0) {
+        return nullptr;
+    }
+
+    // Own queue first, newest job (still warm in cache)
+    {
+        auto& own = *queues_[queueIndex];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.jobs.empty()) {
+            JobPtr job = std::move(own.jobs.back());
+            own.jobs.pop_back();
+            queuedJobs_.fetch_sub(1, std::memory_order_relaxed);
+            return job;
+        }
+    }
+
+    // Then steal the oldest job from everyone else
+    for (size_t offset = 1; offset < queues_.size(); ++offset) {
+        auto& victim = *queues_[(queueIndex + offset) % queues_.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.jobs.empty()) {
+            JobPtr job = std::move(victim.jobs.front());
+            victim.jobs.pop_front();
+            queuedJobs_.fetch_sub(1, std::memory_order_relaxed);
+            return job;
+        }
+    }
+    return nullptr;
+}
+
+void JobSystem::WorkerLoop(size_t queueIndex) {
+    tlsOwner = this;
+    tlsQueueIndex = queueIndex;
+    profiling::TraceProfiler::SetThreadName("Job Worker");
+
+    while (true) {
+        if (TryRunOne()) {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleepMutex_);
+        wakeWorkers_.wait(lock, [this] {
+            return stopping_ || queuedJobs_.load(std::memory_order_acquire) > 0;
+        });
+        if (stopping_) {
+            break;
+        }
+    }
+
+    tlsOwner = nullptr;
+}
+
+void JobSystem::RunParallelFor(ParallelForContext& context) {
+    size_t chunkCount = (context.end - context.begin + context.grainSize - 1) / context.grainSize;
+    // The calling thread works too, so it needs at most chunkCount - 1 helpers
+    size_t helpers = std::min(workers_.size(), chunkCount - 1);
+
+    context.activeHelpers.store(helpers, std::memory_order_relaxed);
+    for (size_t i = 0; i < helpers; ++i) {
+        Schedule([&context] {
+            context.RunChunks();
+            context.activeHelpers.fetch_sub(1, std::memory_order_release);
+        });
+    }
+
+    context.RunChunks();
+
+    // Helpers reference context on this stack frame; keep busy until they're out
+    while (context.activeHelpers.load(std::memory_order_acquire) > 0) {
+        if (!TryRunOne()) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+size_t JobSystem::CurrentQueueIndex() const {
+    return tlsOwner == this ? tlsQueueIndex : 0;
+}
+
+} // namespace engine::job
@@ -0,0 +1,164 @@
+// src/engine/core/job/JobSystem.hpp
+
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+
+namespace engine::job {
+
+namespace detail {
+struct Job {
+    std::function<void()> fn;
+    std::mutex mutex;                               // Guards done / continuations
+    std::vector<std::shared_ptr<Job>> continuations;
+    std::atomic<bool> done{false};
+};
+} // namespace detail
+
+// Reference to a scheduled job; cheap to copy. A default handle is complete.
+class JobHandle {
+public:
+    JobHandle() = default;
+
+    bool IsValid() const { return job_ != nullptr; }
+    bool IsComplete() const { return !job_ || job_->done.load(std::memory_order_acquire); }
+
+private:
+    friend class JobSystem;
+    explicit JobHandle(std::shared_ptr<detail::Job> job) : job_(std::move(job)) {}
+
+    std::shared_ptr<detail::Job> job_;
+};
+
+// Work-stealing thread pool shared by the whole engine.
+//
+// Each worker owns a deque: it pushes and pops its own jobs at the back and
+// steals from the front of the others when it runs dry. Threads that are not
+// workers (the main thread) submit into a shared injection queue. Wait() and
+// ParallelFor() never block idle: the waiting thread runs queued jobs until
+// the thing it waits for is done, so nested parallelism cannot deadlock.
+//
+// With zero workers the system is single-threaded and deterministic: jobs run
+// inline at Schedule() time in submission order, continuations run right after
+// their parent, and ParallelFor() walks its chunks front to back.
+class JobSystem {
+public:
+    static constexpr size_t AUTO_DETECT = std::numeric_limits<size_t>::max();
+
+    explicit JobSystem(size_t workerCount = 0);
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    // Restarts the pool with workerCount threads (AUTO_DETECT: one per core,
+    // minus the calling thread). Must not be called while jobs are in flight.
+    void SetWorkerCount(size_t workerCount);
+    size_t GetWorkerCount() const { return workers_.size(); }
+    bool IsSingleThreaded() const { return workers_.empty(); }
+
+    JobHandle Schedule(std::function<void()> fn);
+
+    // Continuation: runs fn once dependency has completed
+    JobHandle ScheduleAfter(const JobHandle& dependency, std::function<void()> fn);
+
+    // Runs other jobs on this thread until handle completes
+    void Wait(const JobHandle& handle);
+
+    // Calls fn(chunkBegin, chunkEnd) over [begin, end) in chunks of at most
+    // grainSize elements, spread across the workers and the calling thread.
+    // Returns once every chunk has run.
+    template<typename Fn>
+    void ParallelFor(size_t begin, size_t end, size_t grainSize, Fn&& fn);
+
+    static size_t DetectWorkerCount();
+
+private:
+    using JobPtr = std::shared_ptr<detail::Job>;
+
+    struct WorkQueue {
+        std::mutex mutex;
+        std::deque<JobPtr> jobs;
+    };
+
+    // Shared state of one ParallelFor call; lives on the caller's stack
+    struct ParallelForContext {
+        size_t begin;
+        size_t end;
+        size_t grainSize;
+        std::atomic<size_t> nextChunk{0};
+        std::atomic<size_t> activeHelpers{0};
+        void (*invoke)(void* fn, size_t chunkBegin, size_t chunkEnd);
+        void* fn;
+
+        void RunChunks() {
+            size_t chunkCount = (end - begin + grainSize - 1) / grainSize;
+            for (size_t chunk = nextChunk.fetch_add(1, std::memory_order_relaxed);
+                 chunk < chunkCount;
+                 chunk = nextChunk.fetch_add(1, std::memory_order_relaxed)) {
+                size_t chunkBegin = begin + chunk * grainSize;
+                invoke(fn, chunkBegin, std::min(end, chunkBegin + grainSize));
+            }
+        }
+    };
+
+    void Start(size_t workerCount);
+    void Stop();
+    void WorkerLoop(size_t queueIndex);
+
+    void Submit(JobPtr job);
+    void Execute(const JobPtr& job);
+    bool TryRunOne();
+    JobPtr PopOrSteal(size_t queueIndex);
+    void RunParallelFor(ParallelForContext& context);
+
+    size_t CurrentQueueIndex() const;
+
+    // queues_[0] is the injection queue for non-worker threads;
+    // queues_[i + 1] belongs to workers_[i]
+    std::vector<std::unique_ptr<WorkQueue>> queues_;
+    std::vector<std::thread> workers_;
+
+    std::atomic<size_t> queuedJobs_{0};
+    std::mutex sleepMutex_;
+    std::condition_variable wakeWorkers_;
+    bool stopping_ = false;
+};
+
+template<typename Fn>
+void JobSystem::ParallelFor(size_t begin, size_t end, size_t grainSize, Fn&& fn) {
+    if (begin >= end) {
+        return;
+    }
+    grainSize = std::max<size_t>(grainSize, 1);
+
+    if (IsSingleThreaded() || end - begin <= grainSize) {
+        for (size_t chunkBegin = begin; chunkBegin < end; chunkBegin += grainSize) {
+            fn(chunkBegin, std::min(end, chunkBegin + grainSize));
+        }
+        return;
+    }
+
+    using FnType = std::remove_reference_t<Fn>;
+    ParallelForContext context;
+    context.begin = begin;
+    context.end = end;
+    context.grainSize = grainSize;
+    context.fn = const_cast<void*>(static_cast<const void*>(&fn));
+    context.invoke = [](void* f, size_t chunkBegin, size_t chunkEnd) {
+        (*static_cast<FnType*>(f))(chunkBegin, chunkEnd);
+    };
+    RunParallelFor(context);
+}
+
+} // namespace engine::job
@@ -0,0 +1,204 @@
+// src/engine/core/log/Logger.cpp
+
+#include "Logger.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+namespace engine::log {
+
+namespace {
+
+int64_t NowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Bounded multi-producer queue (Vyukov): each slot's sequence says whether
+// it is free for position p (== p) or holds the line for p (== p + 1)
+struct Slot {
+    std::atomic<size_t> sequence{0};
+    Level level = Level::Info;
+    const char* category = nullptr;
+    uint32_t length = 0;
+    char text[Logger::MAX_MESSAGE_LENGTH];
+};
+
+class LogQueue {
+public:
+    LogQueue() {
+        for (size_t i = 0; i < slots_.size(); ++i) {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        writer_ = std::thread(&LogQueue::WriterLoop, this);
+    }
+
+    ~LogQueue() {
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex_);
+            stopping_ = true;
+        }
+        wake_.notify_one();
+        writer_.join();
+    }
+
+    void Push(Level level, const char* category, std::string_view text) {
+        size_t position = enqueuePos_.load(std::memory_order_relaxed);
+        Slot* slot = nullptr;
+        while (true) {
+            slot = &slots_[position & MASK];
+            size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+            if (diff == 0) {
+                if (enqueuePos_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);  // Full: never block the caller
+                return;
+            } else {
+                position = enqueuePos_.load(std::memory_order_relaxed);
+            }
+        }
+
+        slot->level = level;
+        slot->category = category;
+        slot->length = static_cast<uint32_t>(std::min(text.size(), sizeof(slot->text)));
+        std::memcpy(slot->text, text.data(), slot->length);
+        slot->sequence.store(position + 1, std::memory_order_release);
+
+        if (level >= Level::Warn) {
+            wake_.notify_one();
+        }
+    }
+
+    void Flush() {
+        size_t target = enqueuePos_.load(std::memory_order_acquire);
+        wake_.notify_one();
+        while (writtenPos_.load(std::memory_order_acquire) < target) {
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+    }
+
+    uint64_t GetDroppedCount() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    static constexpr size_t MASK = Logger::QUEUE_CAPACITY - 1;
+    static_assert((Logger::QUEUE_CAPACITY & MASK) == 0, "QUEUE_CAPACITY must be a power of two");
+
+    void WriterLoop() {
+        uint64_t reportedDrops = 0;
+        while (true) {
+            bool wrote = Drain();
+
+            uint64_t drops = dropped_.load(std::memory_order_relaxed);
+            if (drops != reportedDrops) {
+                std::fprintf(stderr, "[Logger] Queue full, dropped %llu messages\n",
+                             static_cast<unsigned long long>(drops - reportedDrops));
+                std::fflush(stderr);
+                reportedDrops = drops;
+            }
+            if (wrote) {
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(wakeMutex_);
+            if (stopping_) {
+                break;
+            }
+            // Producers don't lock, so the wait is bounded instead of exact
+            wake_.wait_for(lock, std::chrono::milliseconds(5));
+        }
+        Drain();
+    }
+
+    // Writes every published line; returns whether anything was written
+    bool Drain() {
+        bool wroteOut = false;
+        bool wroteErr = false;
+        size_t position = writtenPos_.load(std::memory_order_relaxed);
+        while (true) {
+            Slot& slot = slots_[position & MASK];
+            if (slot.sequence.load(std::memory_order_acquire) != position + 1) {
+                break;
+            }
+
+            std::FILE* out = slot.level >= Level::Warn ? stderr : stdout;
+            std::fprintf(out, "[%s] %.*s\n", slot.category ? slot.category : "Log",
+                         static_cast<int>(slot.length), slot.text);
+            (out == stderr ? wroteErr : wroteOut) = true;
+
+            slot.sequence.store(position + Logger::QUEUE_CAPACITY, std::memory_order_release);
+            ++position;
+            writtenPos_.store(position, std::memory_order_release);
+        }
+        if (wroteOut) std::fflush(stdout);
+        if (wroteErr) std::fflush(stderr);
+        return wroteOut || wroteErr;
+    }
+
+    std::array<Slot, Logger::QUEUE_CAPACITY> slots_;
+    alignas(64) std::atomic<size_t> enqueuePos_{0};
+    alignas(64) std::atomic<size_t> writtenPos_{0};
+    std::atomic<uint64_t> dropped_{0};
+
+    std::thread writer_;
+    std::mutex wakeMutex_;
+    std::condition_variable wake_;
+    bool stopping_ = false;
+};
+
+// Started on first use, drained and joined at exit
+LogQueue& GetQueue() {
+    static LogQueue queue;
+    return queue;
+}
+
+} // namespace
+
+std::atomic<Level> Logger::level_{Level::Info};
+
+void Logger::Enqueue(Level level, const char* category, std::string_view text) {
+    GetQueue().Push(level, category, text);
+}
+
+void Logger::Flush() {
+    GetQueue().Flush();
+}
+
+uint64_t Logger::GetDroppedCount() {
+    return GetQueue().GetDroppedCount();
+}
+
+bool RateLimiter::Allow(uint32_t& suppressed) {
+    int64_t now = NowNs();
+    int64_t next = nextAllowedNs_.load(std::memory_order_relaxed);
+    if (now < next || !nextAllowedNs_.compare_exchange_strong(next, now + intervalNs_, std::memory_order_relaxed)) {
+        suppressed_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    suppressed = suppressed_.exchange(0, std::memory_order_relaxed);
+    return true;
+}
+
+LogMessage::LogMessage(Level level, const char* category, uint32_t suppressed)
+    : level_(level)
+    , category_(category)
+    , suppressed_(suppressed)
+    , buffer_(text_, sizeof(text_))
+    , stream_(&buffer_) {
+}
+
+LogMessage::~LogMessage() {
+    if (suppressed_ > 0) {
+        stream_ << " (" << suppressed_ << " similar suppressed)";
+    }
+    Logger::Enqueue(level_, category_, std::string_view(text_, buffer_.Length()));
+}
+
+} // namespace engine::log
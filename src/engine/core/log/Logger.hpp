@@ -0,0 +1,141 @@
+// src/engine/core/log/Logger.hpp
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <ostream>
+#include <streambuf>
+#include <string_view>
+
+namespace engine::log {
+
+enum class Level : uint8_t {
+    Trace = 0,
+    Debug,
+    Info,
+    Warn,
+    Error,
+    Off
+};
+
+} // namespace engine::log
+
+// Statements below this level are compiled out entirely (arguments are not
+// evaluated). CMake: -DENGINE_LOG_LEVEL=Info. 0 = Trace ... 4 = Error, 5 = Off.
+#ifndef ENGINE_LOG_MIN_LEVEL
+#ifdef NDEBUG
+#define ENGINE_LOG_MIN_LEVEL 2
+#else
+#define ENGINE_LOG_MIN_LEVEL 0
+#endif
+#endif
+
+namespace engine::log {
+
+// False for levels compiled out by ENGINE_LOG_MIN_LEVEL. The LOG_* macros
+// call this instead of comparing against the macro inline, which raises
+// -Wtype-limits at every call site when the minimum is 0.
+inline constexpr int MIN_LOG_LEVEL = ENGINE_LOG_MIN_LEVEL;
+
+constexpr bool IsLogLevelEnabled(Level level) {
+    return static_cast<int>(level) >= MIN_LOG_LEVEL;
+}
+
+// Asynchronous logger. Callers format into a fixed buffer on their own stack
+// and push the line into a bounded lock-free queue; a background thread
+// drains it to stdout (Warn/Error to stderr) in batches. A full queue drops
+// the line instead of blocking, and the drop count is reported later.
+//
+//   LOG_INFO("EnemySpawnSystem") << "Spawned zombie #" << totalSpawned_;
+//   LOG_DEBUG_EVERY("DamageSystem", 1000) << "Collision A=" << a << " B=" << b;
+//
+// Output keeps the engine's "[Category] message" format. Categories must be
+// string literals (or otherwise outlive the program, like System::GetName()).
+class Logger {
+public:
+    static constexpr size_t QUEUE_CAPACITY = 4096;      // Power of two
+    static constexpr size_t MAX_MESSAGE_LENGTH = 256;   // Longer lines are truncated
+
+    static void SetLevel(Level level) { level_.store(level, std::memory_order_relaxed); }
+    static Level GetLevel() { return level_.load(std::memory_order_relaxed); }
+    static bool IsEnabled(Level level) { return level >= GetLevel(); }
+
+    static void Enqueue(Level level, const char* category, std::string_view text);
+
+    // Blocks until every line queued before the call has been written
+    static void Flush();
+
+    static uint64_t GetDroppedCount();
+
+private:
+    static std::atomic<Level> level_;
+};
+
+// Allows one line per interval per call site; the next allowed line reports
+// how many were suppressed in between
+class RateLimiter {
+public:
+    explicit RateLimiter(uint32_t intervalMs) : intervalNs_(int64_t(intervalMs) * 1000000) {}
+
+    // Returns false to suppress; on true, suppressed holds the skipped count
+    bool Allow(uint32_t& suppressed);
+
+private:
+    int64_t intervalNs_;
+    std::atomic<int64_t> nextAllowedNs_{0};
+    std::atomic<uint32_t> suppressed_{0};
+};
+
+// One log line under construction; queued when it goes out of scope
+class LogMessage {
+public:
+    LogMessage(Level level, const char* category, uint32_t suppressed = 0);
+    ~LogMessage();
+
+    LogMessage(const LogMessage&) = delete;
+    LogMessage& operator=(const LogMessage&) = delete;
+
+    std::ostream& Stream() { return stream_; }
+
+private:
+    // Writes into text_ and silently truncates when full
+    class FixedBuffer : public std::streambuf {
+    public:
+        FixedBuffer(char* begin, size_t size) { setp(begin, begin + size); }
+        size_t Length() const { return static_cast<size_t>(pptr() - pbase()); }
+    };
+
+    Level level_;
+    const char* category_;
+    uint32_t suppressed_;
+    char text_[Logger::MAX_MESSAGE_LENGTH];
+    FixedBuffer buffer_;
+    std::ostream stream_;
+};
+
+} // namespace engine::log
+
+#define ENGINE_LOG_IMPL(level, category) \
+    if constexpr (!::engine::log::IsLogLevelEnabled(level)) {} \
+    else if (!::engine::log::Logger::IsEnabled(level)) {} \
+    else ::engine::log::LogMessage(level, category).Stream()
+
+#define ENGINE_LOG_EVERY_IMPL(level, category, intervalMs) \
+    if constexpr (!::engine::log::IsLogLevelEnabled(level)) {} \
+    else if (!::engine::log::Logger::IsEnabled(level)) {} \
+    else if (static ::engine::log::RateLimiter engineLogLimiter_(intervalMs); false) {} \
+    else if (uint32_t engineLogSuppressed_ = 0; !engineLogLimiter_.Allow(engineLogSuppressed_)) {} \
+    else ::engine::log::LogMessage(level, category, engineLogSuppressed_).Stream()
+
+#define LOG_TRACE(category) ENGINE_LOG_IMPL(::engine::log::Level::Trace, category)
+#define LOG_DEBUG(category) ENGINE_LOG_IMPL(::engine::log::Level::Debug, category)
+#define LOG_INFO(category)  ENGINE_LOG_IMPL(::engine::log::Level::Info, category)
+#define LOG_WARN(category)  ENGINE_LOG_IMPL(::engine::log::Level::Warn, category)
+#define LOG_ERROR(category) ENGINE_LOG_IMPL(::engine::log::Level::Error, category)
+
+// At most one line per intervalMs from this call site
+#define LOG_DEBUG_EVERY(category, intervalMs) ENGINE_LOG_EVERY_IMPL(::engine::log::Level::Debug, category, intervalMs)
+#define LOG_INFO_EVERY(category, intervalMs)  ENGINE_LOG_EVERY_IMPL(::engine::log::Level::Info, category, intervalMs)
+#define LOG_WARN_EVERY(category, intervalMs)  ENGINE_LOG_EVERY_IMPL(::engine::log::Level::Warn, category, intervalMs)
@@ -0,0 +1,178 @@
+// src/engine/core/profiling/TraceProfiler.cpp
+
+#include "TraceProfiler.hpp"
+#include "engine/core/log/Logger.hpp"
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace engine::profiling {
+
+namespace {
+
+struct TraceEvent {
+    const char* name;
+    int64_t startNs;
+    int64_t durationNs;
+};
+
+// Written only by its owning thread; read by EndCapture() up to the
+// published count
+struct ThreadBuffer {
+    uint32_t threadId = 0;
+    std::atomic<const char*> threadName{nullptr};
+    std::atomic<uint32_t> capture{0};   // Capture the events belong to
+    std::atomic<size_t> count{0};
+    std::vector<TraceEvent> events;
+};
+
+struct Registry {
+    std::mutex mutex;  // Guards buffers; taken once per thread and per dump
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+    std::atomic<uint32_t> capture{0};
+    std::atomic<TraceProfiler::Clock::rep> captureStart{0};
+};
+
+Registry& GetRegistry() {
+    static Registry registry;
+    return registry;
+}
+
+thread_local ThreadBuffer* tlsBuffer = nullptr;
+
+ThreadBuffer& GetThreadBuffer() {
+    if (!tlsBuffer) {
+        auto buffer = std::make_unique<ThreadBuffer>();
+
+        // Buffers outlive their threads so a dump never dangles
+        auto& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        buffer->threadId = static_cast<uint32_t>(registry.buffers.size() + 1);
+        tlsBuffer = buffer.get();
+        registry.buffers.push_back(std::move(buffer));
+    }
+    return *tlsBuffer;
+}
+
+void WriteEscaped(std::ostream& out, const char* text) {
+    for (const char* c = text; *c; ++c) {
+        if (*c == '"' || *c == '\\') {
+            out << '\\';
+        }
+        out << *c;
+    }
+}
+
+} // namespace
+
+std::atomic<bool> TraceProfiler::capturing_{false};
+
+void TraceProfiler::BeginCapture() {
+    auto& registry = GetRegistry();
+    registry.captureStart.store(Clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+    // Buffers still tagged with the old capture reset on their next Record()
+    registry.capture.fetch_add(1, std::memory_order_release);
+    capturing_.store(true, std::memory_order_release);
+    LOG_INFO("TraceProfiler") << "Capture started";
+}
+
+void TraceProfiler::Record(const char* name, Clock::time_point start, Clock::time_point end) {
+    auto& registry = GetRegistry();
+    uint32_t capture = registry.capture.load(std::memory_order_acquire);
+    ThreadBuffer& buffer = GetThreadBuffer();
+
+    if (buffer.capture.load(std::memory_order_relaxed) != capture) {
+        // Threads that never record never pay for the storage
+        if (buffer.events.empty()) {
+            buffer.events.resize(EVENTS_PER_THREAD);
+        }
+        buffer.count.store(0, std::memory_order_relaxed);
+        buffer.capture.store(capture, std::memory_order_release);
+    }
+
+    Clock::time_point captureStart(Clock::duration(registry.captureStart.load(std::memory_order_relaxed)));
+    if (start < captureStart) {
+        return;  // Scope opened during an earlier capture
+    }
+
+    size_t index = buffer.count.load(std::memory_order_relaxed);
+    if (index >= buffer.events.size()) {
+        return;
+    }
+    auto& event = buffer.events[index];
+    event.name = name;
+    event.startNs = std::chrono::duration_cast<std::chrono::nanoseconds>(start - captureStart).count();
+    event.durationNs = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    buffer.count.store(index + 1, std::memory_order_release);
+}
+
+void TraceProfiler::SetThreadName(const char* name) {
+    GetThreadBuffer().threadName.store(name, std::memory_order_relaxed);
+}
+
+bool TraceProfiler::EndCapture(const std::string& path) {
+    if (!capturing_.exchange(false, std::memory_order_acq_rel)) {
+        return false;
+    }
+
+    std::ofstream file(path);
+    if (!file) {
+        LOG_ERROR("TraceProfiler") << "Failed to open " << path;
+        return false;
+    }
+
+    auto& registry = GetRegistry();
+    uint32_t capture = registry.capture.load(std::memory_order_acquire);
+    size_t written = 0;
+    size_t dropped = 0;
+
+    file << std::fixed << std::setprecision(3);
+    file << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+    bool first = true;
+    auto separator = [&first, &file]() {
+        file << (first ? "" : ",\n");
+        first = false;
+    };
+
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (const auto& buffer : registry.buffers) {
+        if (const char* threadName = buffer->threadName.load(std::memory_order_relaxed)) {
+            separator();
+            file << "{\"ph\": \"M\", \"name\": \"thread_name\", \"pid\": 1, \"tid\": " << buffer->threadId
+                 << ", \"args\": {\"name\": \"";
+            WriteEscaped(file, threadName);
+            file << "\"}}";
+        }
+
+        if (buffer->capture.load(std::memory_order_acquire) != capture) {
+            continue;  // Thread recorded nothing this capture
+        }
+        size_t count = buffer->count.load(std::memory_order_acquire);
+        if (count >= buffer->events.size()) {
+            dropped++;
+        }
+        for (size_t i = 0; i < count; ++i) {
+            const auto& event = buffer->events[i];
+            separator();
+            // Chrome traces use microseconds
+            file << "{\"ph\": \"X\", \"name\": \"";
+            WriteEscaped(file, event.name);
+            file << "\", \"pid\": 1, \"tid\": " << buffer->threadId
+                 << ", \"ts\": " << event.startNs / 1000.0
+                 << ", \"dur\": " << event.durationNs / 1000.0 << "}";
+        }
+        written += count;
+    }
+    file << "\n]}\n";
+
+    LOG_INFO("TraceProfiler") << "Wrote " << written << " events to " << path;
+    if (dropped > 0) {
+        LOG_WARN("TraceProfiler") << dropped
+                                  << " thread buffer(s) filled up; later events were dropped";
+    }
+    return true;
+}
+
+} // namespace engine::profiling
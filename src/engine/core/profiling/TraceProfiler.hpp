@@ -0,0 +1,90 @@
+// src/engine/core/profiling/TraceProfiler.hpp
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+// Scoped trace markers written as Chrome Trace Event JSON (chrome://tracing,
+// ui.perfetto.dev). Build with ENGINE_TRACE_PROFILING=0 (CMake:
+// -DENGINE_TRACE_PROFILER=OFF) and PROFILE_SCOPE compiles to nothing.
+#ifndef ENGINE_TRACE_PROFILING
+#define ENGINE_TRACE_PROFILING 1
+#endif
+
+namespace engine::profiling {
+
+// Records complete events ("ph": "X") between BeginCapture() and EndCapture().
+//
+// Every thread appends into its own fixed-size buffer: the owning thread is
+// the only writer and publishes each event with a release store, so recording
+// takes no locks. A buffer that fills up drops further events for the rest of
+// the capture. Names must outlive the capture (string literals, or
+// System::GetName()).
+//
+//   void CollisionSystem::Update(float) {
+//       PROFILE_SCOPE("CollisionSystem::Update");
+//       ...
+//   }
+class TraceProfiler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr size_t EVENTS_PER_THREAD = 1 << 16;
+
+    // Starts a new capture, discarding events from the previous one
+    static void BeginCapture();
+
+    // Stops recording and writes the capture to path; false if nothing was
+    // being captured or the file can't be written
+    static bool EndCapture(const std::string& path);
+
+    static bool IsCapturing() { return capturing_.load(std::memory_order_relaxed); }
+
+    // Label for the calling thread in the trace viewer
+    static void SetThreadName(const char* name);
+
+    static void Record(const char* name, Clock::time_point start, Clock::time_point end);
+
+private:
+    static std::atomic<bool> capturing_;
+};
+
+class ScopedTrace {
+public:
+    explicit ScopedTrace(const char* name)
+        : name_(name), active_(TraceProfiler::IsCapturing()) {
+        if (active_) {
+            start_ = TraceProfiler::Clock::now();
+        }
+    }
+
+    ~ScopedTrace() {
+        if (active_) {
+            TraceProfiler::Record(name_, start_, TraceProfiler::Clock::now());
+        }
+    }
+
+    ScopedTrace(const ScopedTrace&) = delete;
+    ScopedTrace& operator=(const ScopedTrace&) = delete;
+
+private:
+    const char* name_;
+    bool active_;
+    TraceProfiler::Clock::time_point start_;
+};
+
+} // namespace engine::profiling
+
+#define ENGINE_TRACE_CONCAT_IMPL(a, b) a##b
+#define ENGINE_TRACE_CONCAT(a, b) ENGINE_TRACE_CONCAT_IMPL(a, b)
+
+#if ENGINE_TRACE_PROFILING
+#define PROFILE_SCOPE(name) \
+    ::engine::profiling::ScopedTrace ENGINE_TRACE_CONCAT(profileScope_, __LINE__)(name)
+#else
+#define PROFILE_SCOPE(name) ((void)0)
+#endif
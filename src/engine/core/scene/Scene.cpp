@@ -20,7 +20,7 @@ ECS::EntityID Scene::CreateSceneEntity(const std::string& name) {
 
 void Scene::DestroySceneEntity(ECS::EntityID id) {
     if (world_) {
-        world_->GetEntityFactory().DestroyEntity(id);
+        world_->DestroyEntity(id);
         sceneEntities_.erase(
             std::remove(sceneEntities_.begin(), sceneEntities_.end(), id),
             sceneEntities_.end()
@@ -32,7 +32,7 @@ void Scene::DestroySceneEntity(ECS::EntityID id) {
 void Scene::ClearSceneEntities() {
     if (world_) {
         for (auto entityId: sceneEntities_) {
-            world_->GetEntityFactory().DestroyEntity(entityId);
+            world_->DestroyEntity(entityId);
         }
         sceneEntities_.clear();
     }
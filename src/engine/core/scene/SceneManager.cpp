@@ -2,7 +2,7 @@
 
 #include "SceneManager.hpp"
 #include "engine/core/event/SceneEvents.hpp"
-#include <iostream>
+#include "engine/core/log/Logger.hpp"
 
 namespace engine::scene {
 
@@ -14,45 +14,45 @@ SceneManager::~SceneManager() {
 
 void SceneManager::RegisterScene(const std::string& sceneId, SceneFactory factory) {
     sceneFactories_[sceneId] = factory;
-    std::cout << "[SceneManager] Registered scene: " << sceneId << std::endl;
+    LOG_INFO("SceneManager") << "Registered scene: " << sceneId;
 }
 
 void SceneManager::SetScene(std::unique_ptr<Scene> newScene) {
-    std::cout << "[SceneManager] Switching from " 
-              << GetCurrentSceneId() << " to " << newScene->GetSceneId() << "\n";
+    LOG_INFO("SceneManager") << "Switching from " 
+                             << GetCurrentSceneId() << " to " << newScene->GetSceneId();
               
     if (currentScene_) {
-        std::cout << "[SceneManager] Unloading scene: " << currentScene_->GetSceneId() << std::endl;
+        LOG_INFO("SceneManager") << "Unloading scene: " << currentScene_->GetSceneId();
         currentScene_->Unload();
     }
     
     currentScene_ = std::move(newScene);
     
     if (currentScene_) {
-        std::cout << "[SceneManager] Loading scene: " << currentScene_->GetSceneId() << std::endl;
+        LOG_INFO("SceneManager") << "Loading scene: " << currentScene_->GetSceneId();
 
         if (world_) {
-            std::cout << "[SceneManager] Setting World for scene..." << std::endl;
+            LOG_INFO("SceneManager") << "Setting World for scene...";
             currentScene_->SetWorld(world_);
-            std::cout << "[SceneManager] World set successfully!" << std::endl;
+            LOG_INFO("SceneManager") << "World set successfully!";
         } else {
-            std::cout << "[SceneManager] WARNING: world_ is null!" << std::endl;
+            LOG_WARN("SceneManager") << "world_ is null!";
         }
 
         if (eventManager_) {
-            std::cout << "[SceneManager] Setting EventManager for scene..." << std::endl;
+            LOG_INFO("SceneManager") << "Setting EventManager for scene...";
             currentScene_->SetEventManager(eventManager_);
-            std::cout << "[SceneManager] EventManager set successfully!" << std::endl;
+            LOG_INFO("SceneManager") << "EventManager set successfully!";
         } else {
-            std::cout << "[SceneManager] ERROR: eventManager_ is null!" << std::endl;
+            LOG_ERROR("SceneManager") << "eventManager_ is null!";
         }
 
         if (inputManager_) {
-            std::cout << "[SceneManager] Setting InputManager for scene..." << std::endl;
+            LOG_INFO("SceneManager") << "Setting InputManager for scene...";
             currentScene_->SetInputManager(inputManager_);
-            std::cout << "[SceneManager] InputManager set successfully!" << std::endl;
+            LOG_INFO("SceneManager") << "InputManager set successfully!";
         } else {
-            std::cout << "[SceneManager] ERROR: InputManager is null!" << std::endl;
+            LOG_ERROR("SceneManager") << "InputManager is null!";
         }
 
         currentScene_->Load();
@@ -65,7 +65,7 @@ void SceneManager::Update(float deltaTime) {
         if (newScene) {
             SetScene(std::move(newScene));
         } else {
-            std::cout << "[SceneManager] Warning: Scene '" << nextSceneId_ << "' not found!" << std::endl;
+            LOG_WARN("SceneManager") << "Scene '" << nextSceneId_ << "' not found!";
         }
         sceneChangeRequested_ = false;
     }
@@ -89,7 +89,7 @@ void SceneManager::HandleEvent(const SDL_Event& event) {
 
 void SceneManager::UnloadScene() {
     if (currentScene_) {
-        std::cout << "[SceneManager] Cleaning up scene: " << currentScene_->GetSceneId() << std::endl;
+        LOG_INFO("SceneManager") << "Cleaning up scene: " << currentScene_->GetSceneId();
         currentScene_->Unload();
         currentScene_.reset();
     }
@@ -0,0 +1,83 @@
+// src/engine/core/time/FramePacer.cpp
+
+#include "FramePacer.hpp"
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <thread>
+
+namespace engine::time {
+
+void FramePacer::SetTargetRate(double framesPerSecond) {
+    targetRate_ = framesPerSecond > 0.0 ? framesPerSecond : 0.0;
+    periodNs_ = targetRate_ > 0.0 ? static_cast<uint64_t>(1e9 / targetRate_ + 0.5) : 0;
+    deadlineNs_ = frameStartNs_ + periodNs_;
+}
+
+void FramePacer::Reset() {
+    frameStartNs_ = SDL_GetTicksNS();
+    deadlineNs_ = frameStartNs_ + periodNs_;
+}
+
+float FramePacer::WaitForNextFrame() {
+    uint64_t now = SDL_GetTicksNS();
+    bool missed = periodNs_ > 0 && now > deadlineNs_;
+
+    if (periodNs_ > 0 && !missed) {
+        if (deadlineNs_ - now > spinThresholdNs_) {
+            SDL_DelayNS(deadlineNs_ - now - spinThresholdNs_);
+        }
+        // Sub-threshold remainder: yield rather than trust the sleep
+        while ((now = SDL_GetTicksNS()) < deadlineNs_) {
+            std::this_thread::yield();
+        }
+    }
+
+    uint64_t frameNs = now - frameStartNs_;
+    frameStartNs_ = now;
+    if (periodNs_ > 0) {
+        // Keep the cadence; a late frame (or a late wake-up) restarts it
+        // rather than bunching the following frames up to catch up
+        deadlineNs_ += periodNs_;
+        if (deadlineNs_ <= now) {
+            deadlineNs_ = now + periodNs_;
+        }
+    }
+
+    RecordFrame(frameNs, missed);
+    return static_cast<float>(frameNs * 1e-9);
+}
+
+void FramePacer::RecordFrame(uint64_t frameNs, bool missed) {
+    double ms = frameNs * 1e-6;
+    frames_++;
+    double delta = ms - mean_;
+    mean_ += delta / frames_;
+    m2_ += delta * (ms - mean_);
+    min_ = frames_ == 1 ? ms : std::min(min_, ms);
+    max_ = frames_ == 1 ? ms : std::max(max_, ms);
+    if (missed) {
+        missed_++;
+    }
+}
+
+FramePacingStats FramePacer::GetStats() const {
+    FramePacingStats stats;
+    stats.frames = frames_;
+    stats.meanMs = mean_;
+    stats.varianceMs2 = frames_ > 1 ? m2_ / (frames_ - 1) : 0.0;
+    stats.minMs = min_;
+    stats.maxMs = max_;
+    stats.missedDeadlines = missed_;
+    return stats;
+}
+
+void FramePacer::ResetStats() {
+    frames_ = 0;
+    mean_ = 0.0;
+    m2_ = 0.0;
+    min_ = 0.0;
+    max_ = 0.0;
+    missed_ = 0;
+}
+
+} // namespace engine::time
@@ -0,0 +1,69 @@
+// src/engine/core/time/FramePacer.hpp
+
+#pragma once
+
+#include <cstdint>
+
+namespace engine::time {
+
+struct FramePacingStats {
+    uint64_t frames = 0;
+    double meanMs = 0.0;
+    double varianceMs2 = 0.0;   // Of the frame time, in ms^2
+    double minMs = 0.0;
+    double maxMs = 0.0;
+    uint64_t missedDeadlines = 0;   // Frames whose work overran the target period
+};
+
+// Caps the frame rate against absolute nanosecond deadlines (SDL_GetTicksNS).
+// Waiting sleeps in one coarse SDL_DelayNS until spinThreshold before the
+// deadline, then yields until it passes, so the OS scheduler's wake-up
+// slop never lands in the frame time. Deadlines advance by exactly one
+// period, so rounding never accumulates; after a missed deadline the
+// schedule restarts from now instead of trying to catch up.
+//
+//   pacer.SetTargetRate(144.0);
+//   while (running) {
+//       float dt = pacer.WaitForNextFrame();
+//       ...
+//   }
+class FramePacer {
+public:
+    static constexpr uint64_t DEFAULT_SPIN_THRESHOLD_NS = 1000000;  // 1 ms
+
+    // Frames per second; 0 or less runs uncapped
+    void SetTargetRate(double framesPerSecond);
+    double GetTargetRate() const { return targetRate_; }
+
+    void SetSpinThreshold(uint64_t nanoseconds) { spinThresholdNs_ = nanoseconds; }
+    uint64_t GetSpinThreshold() const { return spinThresholdNs_; }
+
+    // Starts the schedule (and the first frame) now
+    void Reset();
+
+    // Blocks until the current frame's deadline, starts the next frame and
+    // returns the seconds since the previous frame started
+    float WaitForNextFrame();
+
+    FramePacingStats GetStats() const;
+    void ResetStats();
+
+private:
+    void RecordFrame(uint64_t frameNs, bool missed);
+
+    double targetRate_ = 0.0;
+    uint64_t periodNs_ = 0;
+    uint64_t spinThresholdNs_ = DEFAULT_SPIN_THRESHOLD_NS;
+    uint64_t frameStartNs_ = 0;
+    uint64_t deadlineNs_ = 0;
+
+    // Welford running mean/variance, in ms
+    uint64_t frames_ = 0;
+    double mean_ = 0.0;
+    double m2_ = 0.0;
+    double min_ = 0.0;
+    double max_ = 0.0;
+    uint64_t missed_ = 0;
+};
+
+} // namespace engine::time
@@ -1,7 +1,7 @@
 // src/graphics/Renderer.cpp
 
 #include "Renderer.hpp"
-#include <iostream>
+#include "engine/core/log/Logger.hpp"
 
 namespace engine::graphics {
 
@@ -14,23 +14,37 @@ Renderer::~Renderer() {
 
 bool Renderer::Init(const std::string& windowTitle, int width, int height) {
     if (!SDL_Init(SDL_INIT_VIDEO)) {
-        std::cerr << "[Renderer] Failed to initialize SDL: " << SDL_GetError() << std::endl;
+        LOG_ERROR("Renderer") << "Failed to initialize SDL: " << SDL_GetError();
         return false;
     }
+    sdlInitialized_ = true;
 
     window_ = SDL_CreateWindow(windowTitle.c_str(), width, height, SDL_WINDOW_OPENGL);
     if (!window_) {
-        std::cerr << "[Renderer] Failed to create SDL Window: " << SDL_GetError() << std::endl;
+        LOG_ERROR("Renderer") << "Failed to create SDL Window: " << SDL_GetError();
         return false;
     }
 
     renderer_ = SDL_CreateRenderer(window_, nullptr);
     if (!renderer_) {
-        std::cerr << "[Renderer] Failed to create SDL Renderer: " << SDL_GetError() << std::endl;
+        LOG_ERROR("Renderer") << "Failed to create SDL Renderer: " << SDL_GetError();
         return false;
     }
 
-    std::cout << "[Renderer] SDL3 Initialized. Window and Renderer created.\n";
+    LOG_INFO("Renderer") << "SDL3 Initialized. Window and Renderer created.";
+    return true;
+}
+
+bool Renderer::InitHeadless() {
+    // Events only: the loop still polls for quit requests
+    if (!SDL_Init(SDL_INIT_EVENTS)) {
+        LOG_ERROR("Renderer") << "Failed to initialize SDL: " << SDL_GetError();
+        return false;
+    }
+    sdlInitialized_ = true;
+    headless_ = true;
+
+    LOG_INFO("Renderer") << "Headless mode, no window created";
     return true;
 }
 
@@ -43,21 +57,27 @@ void Renderer::Shutdown() {
         SDL_DestroyWindow(window_);
         window_ = nullptr;
     }
+    if (!sdlInitialized_) {
+        return;
+    }
+    sdlInitialized_ = false;
     SDL_Quit();
-    std::cout << "[Renderer] Shutdown complete.\n";
+    LOG_INFO("Renderer") << "Shutdown complete.";
 }
 
 void Renderer::BeginFrame() {
+    if (!renderer_) return;
     SDL_SetRenderDrawColor(renderer_, 0, 0, 0, 255); // Deep black background for UI area
     SDL_RenderClear(renderer_);
 }
 
 void Renderer::EndFrame() {
+    if (!renderer_) return;
     SDL_RenderPresent(renderer_);
 }
 
 void Renderer::DrawTexture(SDL_Texture* texture, int x, int y, int width, int height, float rotation = 0.0f) {
-    if (!texture) return;
+    if (!texture || !renderer_) return;
 
     SDL_FRect dstRect = { static_cast<float>(x), static_cast<float>(y),
                           static_cast<float>(width), static_cast<float>(height) };
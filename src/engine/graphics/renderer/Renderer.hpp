@@ -12,6 +12,8 @@ public:
     ~Renderer();
 
     bool Init(const std::string& windowTitle, int width, int height);
+    // No window or SDL_Renderer; drawing calls become no-ops
+    bool InitHeadless();
     void Shutdown();
     
     void BeginFrame();
@@ -20,10 +22,13 @@ public:
     void DrawTexture(SDL_Texture* texture, int x, int y, int width, int height, float rotation);
 
     SDL_Renderer* GetSDLRenderer() const { return renderer_; }
+    bool IsHeadless() const { return headless_; }
 
 private:
     SDL_Window* window_ = nullptr;
     SDL_Renderer* renderer_ = nullptr;
+    bool headless_ = false;
+    bool sdlInitialized_ = false;
 };
 
 } // namespace engine::graphics
@@ -0,0 +1,91 @@
+// src/engine/graphics/sprite/RenderQueue.cpp
+
+#include "RenderQueue.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+namespace engine::graphics {
+
+namespace {
+
+constexpr int LAYER_SHIFT = 56;
+constexpr int CLIP_SHIFT = 55;
+constexpr int DEPTH_SHIFT = 32;
+constexpr int TEXTURE_SHIFT = 20;
+constexpr uint64_t DEPTH_MASK = (1ull << 23) - 1;
+constexpr uint64_t TEXTURE_MASK = (1ull << 12) - 1;
+constexpr uint64_t TIE_MASK = (1ull << 20) - 1;
+
+// Float bits reordered so unsigned comparison matches float comparison
+uint32_t OrderedBits(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+} // namespace
+
+uint64_t RenderQueue::MakeKey(int layer, bool clipped, float depth, uint32_t texture, uint32_t tieBreak) {
+    uint64_t biasedLayer = static_cast<uint64_t>(std::clamp(layer, -128, 127) + 128);
+    // Top 23 bits of the ordered float: sign, 8 exponent and 14 mantissa
+    // bits, so ~1/16384 relative precision (0.06 px at a depth of 1000).
+    // The sign stays because world y, and so depth, can be negative.
+    uint64_t depthBits = (OrderedBits(depth) >> 9) & DEPTH_MASK;
+    return (biasedLayer << LAYER_SHIFT)
+         | (static_cast<uint64_t>(clipped) << CLIP_SHIFT)
+         | (depthBits << DEPTH_SHIFT)
+         | ((texture & TEXTURE_MASK) << TEXTURE_SHIFT)
+         | (tieBreak & TIE_MASK);
+}
+
+void RenderQueue::Reserve(size_t count) {
+    items_.reserve(count);
+    scratch_.reserve(count);
+}
+
+void RenderQueue::Sort() {
+    const size_t count = items_.size();
+    if (count < 2) {
+        return;
+    }
+    scratch_.resize(count);
+
+    // All eight byte histograms in one read
+    std::array<std::array<uint32_t, 256>, 8> histograms{};
+    for (const Item& item : items_) {
+        for (int pass = 0; pass < 8; ++pass) {
+            histograms[pass][(item.key >> (pass * 8)) & 0xFF]++;
+        }
+    }
+
+    Item* source = items_.data();
+    Item* destination = scratch_.data();
+    for (int pass = 0; pass < 8; ++pass) {
+        auto& histogram = histograms[pass];
+        const int shift = pass * 8;
+
+        // Every key has the same byte here (common for the layer and the
+        // unused tie bits): the pass would be a plain copy
+        if (histogram[(source[0].key >> shift) & 0xFF] == count) {
+            continue;
+        }
+
+        uint32_t offset = 0;
+        for (uint32_t& bucket : histogram) {
+            uint32_t bucketCount = bucket;
+            bucket = offset;
+            offset += bucketCount;
+        }
+        for (size_t i = 0; i < count; ++i) {
+            destination[histogram[(source[i].key >> shift) & 0xFF]++] = source[i];
+        }
+        std::swap(source, destination);
+    }
+
+    if (source != items_.data()) {
+        items_.swap(scratch_);
+    }
+}
+
+} // namespace engine::graphics
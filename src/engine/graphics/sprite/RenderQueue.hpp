@@ -0,0 +1,45 @@
+// src/engine/graphics/sprite/RenderQueue.hpp
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace engine::graphics {
+
+// Draw order for one frame: each entry is a 64-bit sort key plus the index of
+// the caller's draw record. Sort() is an LSD radix sort (8 bits per pass),
+// so equal keys keep their push order. Buffers are kept between frames, so
+// once they have grown to the peak sprite count nothing is allocated.
+//
+// Key layout, most significant first:
+//   63..56  render layer (signed, clamped to [-128, 127])
+//   55      clipped (sprites sharing a clip rect stay together)
+//   54..32  depth (larger draws later, e.g. a sprite's bottom edge for y-sort)
+//   31..20  texture (handle index, so sprites of one texture batch)
+//   19..0   tie-break (e.g. entity index, stable across frames)
+class RenderQueue {
+public:
+    struct Item {
+        uint64_t key;
+        uint32_t index;
+    };
+
+    static uint64_t MakeKey(int layer, bool clipped, float depth, uint32_t texture, uint32_t tieBreak);
+
+    void Clear() { items_.clear(); }
+    void Reserve(size_t count);
+    void Push(uint64_t key, uint32_t index) { items_.push_back({key, index}); }
+    void Sort();
+
+    const std::vector<Item>& GetItems() const { return items_; }
+    size_t Size() const { return items_.size(); }
+    bool Empty() const { return items_.empty(); }
+
+private:
+    std::vector<Item> items_;
+    std::vector<Item> scratch_;
+};
+
+} // namespace engine::graphics
@@ -0,0 +1,194 @@
+// src/engine/graphics/sprite/SpriteBatch.cpp
+
+#include "SpriteBatch.hpp"
+#include <cmath>
+#include <utility>
+
+namespace engine::graphics {
+
+namespace {
+
+bool SameRect(const SDL_Rect& a, const SDL_Rect& b) {
+    return a.x == b.x && a.y == b.y && a.w == b.w && a.h == b.h;
+}
+
+} // namespace
+
+SpriteBatch::SpriteBatch(SDL_Renderer* renderer)
+    : renderer_(renderer) {
+    vertices_.reserve(MAX_SPRITES_PER_BATCH * 4);
+    indices_.reserve(MAX_SPRITES_PER_BATCH * 6);
+}
+
+void SpriteBatch::Begin() {
+    vertices_.clear();
+    indices_.clear();
+    // Textures may have been destroyed (and their addresses reused) since
+    // the last frame, so the cached size can't be trusted
+    texture_ = nullptr;
+    clipped_ = false;
+    drawCalls_ = 0;
+    sprites_ = 0;
+}
+
+void SpriteBatch::Draw(SDL_Texture* texture,
+                       float x, float y, float width, float height,
+                       float rotation,
+                       const SDL_FPoint* pivot,
+                       const SDL_FRect* sourceRect,
+                       SDL_Color tint,
+                       const SDL_Rect* clipRect,
+                       SDL_FlipMode flip) {
+    if (!PrepareBatch(texture, clipRect)) return;
+
+    // Texture coordinates
+    float u0 = 0.0f, v0 = 0.0f, u1 = 1.0f, v1 = 1.0f;
+    if (sourceRect) {
+        u0 = sourceRect->x / textureWidth_;
+        v0 = sourceRect->y / textureHeight_;
+        u1 = (sourceRect->x + sourceRect->w) / textureWidth_;
+        v1 = (sourceRect->y + sourceRect->h) / textureHeight_;
+    }
+    if (flip & SDL_FLIP_HORIZONTAL) std::swap(u0, u1);
+    if (flip & SDL_FLIP_VERTICAL) std::swap(v0, v1);
+
+    // Corners relative to the pivot, rotated, then moved to the pivot's
+    // screen position. Screen y points down, so the counter-clockwise
+    // rotation is a negative angle here.
+    float pivotX = pivot ? pivot->x : width * 0.5f;
+    float pivotY = pivot ? pivot->y : height * 0.5f;
+    float cornersX[4] = {-pivotX, width - pivotX, width - pivotX, -pivotX};
+    float cornersY[4] = {-pivotY, -pivotY, height - pivotY, height - pivotY};
+    float originX = x + pivotX;
+    float originY = y + pivotY;
+
+    float cosA = 1.0f, sinA = 0.0f;
+    if (rotation != 0.0f) {
+        cosA = std::cos(rotation);
+        sinA = -std::sin(rotation);
+    }
+
+    SDL_FColor color = {tint.r / 255.0f, tint.g / 255.0f, tint.b / 255.0f, tint.a / 255.0f};
+    const float us[4] = {u0, u1, u1, u0};
+    const float vs[4] = {v0, v0, v1, v1};
+
+    AppendQuad(originX, originY, cornersX, cornersY, cosA, sinA, color, us, vs);
+}
+
+void SpriteBatch::DrawQuads(SDL_Texture* texture,
+                            float width, float height,
+                            const SDL_FRect* sourceRect,
+                            const QuadArrays& quads,
+                            float offsetX, float offsetY,
+                            const SDL_Rect* clipRect) {
+    if (quads.count == 0 || !PrepareBatch(texture, clipRect)) return;
+
+    float u0 = 0.0f, v0 = 0.0f, u1 = 1.0f, v1 = 1.0f;
+    if (sourceRect) {
+        u0 = sourceRect->x / textureWidth_;
+        v0 = sourceRect->y / textureHeight_;
+        u1 = (sourceRect->x + sourceRect->w) / textureWidth_;
+        v1 = (sourceRect->y + sourceRect->h) / textureHeight_;
+    }
+    const float us[4] = {u0, u1, u1, u0};
+    const float vs[4] = {v0, v0, v1, v1};
+    const bool interpolate = quads.previousX && quads.previousY && quads.alpha < 1.0f;
+
+    for (size_t i = 0; i < quads.count; ++i) {
+        if (vertices_.size() >= MAX_SPRITES_PER_BATCH * 4) {
+            Flush();  // Same texture and clip carry on in the next batch
+        }
+
+        float centerX = quads.x[i];
+        float centerY = quads.y[i];
+        if (interpolate) {
+            centerX = quads.previousX[i] + (centerX - quads.previousX[i]) * quads.alpha;
+            centerY = quads.previousY[i] + (centerY - quads.previousY[i]) * quads.alpha;
+        }
+
+        float halfWidth = width * quads.scale[i] * 0.5f;
+        float halfHeight = height * quads.scale[i] * 0.5f;
+        const float cornersX[4] = {-halfWidth, halfWidth, halfWidth, -halfWidth};
+        const float cornersY[4] = {-halfHeight, -halfHeight, halfHeight, halfHeight};
+
+        float cosA = 1.0f, sinA = 0.0f;
+        if (quads.rotation && quads.rotation[i] != 0.0f) {
+            cosA = std::cos(quads.rotation[i]);
+            sinA = -std::sin(quads.rotation[i]);
+        }
+
+        SDL_FColor color = {quads.r[i], quads.g[i], quads.b[i], quads.a[i]};
+        AppendQuad(centerX + offsetX, centerY + offsetY, cornersX, cornersY, cosA, sinA, color, us, vs);
+    }
+}
+
+bool SpriteBatch::PrepareBatch(SDL_Texture* texture, const SDL_Rect* clipRect) {
+    if (!texture || !renderer_) return false;
+
+    bool clipped = clipRect != nullptr;
+    bool clipChanged = clipped != clipped_ || (clipped && !SameRect(*clipRect, clip_));
+    if (texture != texture_ || clipChanged || vertices_.size() >= MAX_SPRITES_PER_BATCH * 4) {
+        Flush();
+        if (texture != texture_) {
+            texture_ = texture;
+            SDL_GetTextureSize(texture, &textureWidth_, &textureHeight_);
+        }
+        clipped_ = clipped;
+        if (clipped) {
+            clip_ = *clipRect;
+        }
+    }
+    return textureWidth_ > 0.0f && textureHeight_ > 0.0f;
+}
+
+void SpriteBatch::AppendQuad(float originX, float originY,
+                             const float cornersX[4], const float cornersY[4],
+                             float cosA, float sinA, const SDL_FColor& color,
+                             const float us[4], const float vs[4]) {
+    int base = static_cast<int>(vertices_.size());
+    for (int i = 0; i < 4; ++i) {
+        SDL_Vertex vertex;
+        vertex.position.x = originX + cornersX[i] * cosA - cornersY[i] * sinA;
+        vertex.position.y = originY + cornersX[i] * sinA + cornersY[i] * cosA;
+        vertex.color = color;
+        vertex.tex_coord.x = us[i];
+        vertex.tex_coord.y = vs[i];
+        vertices_.push_back(vertex);
+    }
+    indices_.insert(indices_.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+    sprites_++;
+}
+
+void SpriteBatch::End() {
+    Flush();
+    SetClip(nullptr);
+}
+
+void SpriteBatch::Flush() {
+    if (indices_.empty()) return;
+
+    SetClip(clipped_ ? &clip_ : nullptr);
+    SDL_RenderGeometry(renderer_, texture_,
+                       vertices_.data(), static_cast<int>(vertices_.size()),
+                       indices_.data(), static_cast<int>(indices_.size()));
+    drawCalls_++;
+
+    vertices_.clear();
+    indices_.clear();
+}
+
+void SpriteBatch::SetClip(const SDL_Rect* clipRect) {
+    bool clipped = clipRect != nullptr;
+    if (clipped == appliedClipped_ && (!clipped || SameRect(*clipRect, appliedClip_))) {
+        return;
+    }
+    if (renderer_) {
+        SDL_SetRenderClipRect(renderer_, clipRect);
+    }
+    appliedClipped_ = clipped;
+    if (clipped) {
+        appliedClip_ = *clipRect;
+    }
+}
+
+} // namespace engine::graphics
@@ -0,0 +1,106 @@
+// src/engine/graphics/sprite/SpriteBatch.hpp
+
+#pragma once
+
+#include <SDL3/SDL.h>
+#include <cstddef>
+#include <vector>
+
+namespace engine::graphics {
+
+// Collects sprites into one vertex/index array and draws consecutive sprites
+// that share a texture and clip rect with a single SDL_RenderGeometry call.
+// Corners are rotated on the CPU and the tint is baked into vertex colors,
+// so no texture color/alpha mod is touched. Submit in draw order; every
+// texture or clip change starts a new batch.
+//
+//   batch.Begin();
+//   for (...) batch.Draw(texture, x, y, w, h, rotation, pivot, source, tint, clip);
+//   batch.End();
+class SpriteBatch {
+public:
+    static constexpr size_t MAX_SPRITES_PER_BATCH = 8192;
+
+    explicit SpriteBatch(SDL_Renderer* renderer);
+
+    void Begin();
+
+    // rotation is in radians, counter-clockwise on screen (same as
+    // SpriteRenderer); pivot is relative to the destination's top-left and
+    // defaults to its center. sourceRect null = whole texture, clipRect
+    // null = unclipped.
+    void Draw(SDL_Texture* texture,
+              float x, float y, float width, float height,
+              float rotation = 0.0f,
+              const SDL_FPoint* pivot = nullptr,
+              const SDL_FRect* sourceRect = nullptr,
+              SDL_Color tint = {255, 255, 255, 255},
+              const SDL_Rect* clipRect = nullptr,
+              SDL_FlipMode flip = SDL_FLIP_NONE);
+
+    // Parallel arrays describing count quads (e.g. a particle pool). Quad i
+    // is width x height scaled by scale[i], centered on (x[i], y[i]) and
+    // rotated by rotation[i]; colors are 0..1. With previousX/previousY the
+    // center is interpolated by alpha from the previous position.
+    struct QuadArrays {
+        size_t count = 0;
+        const float* x = nullptr;
+        const float* y = nullptr;
+        const float* previousX = nullptr;  // Optional
+        const float* previousY = nullptr;
+        float alpha = 1.0f;
+        const float* scale = nullptr;
+        const float* rotation = nullptr;   // Optional
+        const float* r = nullptr;
+        const float* g = nullptr;
+        const float* b = nullptr;
+        const float* a = nullptr;
+    };
+
+    // Appends every quad in one pass, all with the same texture/source rect,
+    // shifted by (offsetX, offsetY). Same batching rules as Draw().
+    void DrawQuads(SDL_Texture* texture,
+                   float width, float height,
+                   const SDL_FRect* sourceRect,
+                   const QuadArrays& quads,
+                   float offsetX = 0.0f, float offsetY = 0.0f,
+                   const SDL_Rect* clipRect = nullptr);
+
+    // Flushes what is pending and restores an unclipped renderer
+    void End();
+
+    // For the last Begin()/End() pair
+    size_t GetDrawCallCount() const { return drawCalls_; }
+    size_t GetSpriteCount() const { return sprites_; }
+
+private:
+    // Starts a new batch if texture/clip differ or the current one is full;
+    // false if the texture can't be drawn
+    bool PrepareBatch(SDL_Texture* texture, const SDL_Rect* clipRect);
+    void AppendQuad(float originX, float originY,
+                    const float cornersX[4], const float cornersY[4],
+                    float cosA, float sinA, const SDL_FColor& color,
+                    const float us[4], const float vs[4]);
+    void Flush();
+    void SetClip(const SDL_Rect* clipRect);
+
+    SDL_Renderer* renderer_;
+    std::vector<SDL_Vertex> vertices_;
+    std::vector<int> indices_;
+
+    // Current batch state
+    SDL_Texture* texture_ = nullptr;
+    float textureWidth_ = 0.0f;
+    float textureHeight_ = 0.0f;
+    bool clipped_ = false;
+    SDL_Rect clip_ = {0, 0, 0, 0};
+
+    // What the renderer currently has applied
+    bool appliedClipped_ = false;
+    SDL_Rect appliedClip_ = {0, 0, 0, 0};
+
+    size_t drawCalls_ = 0;
+    size_t sprites_ = 0;
+};
+
+} // namespace engine::graphics
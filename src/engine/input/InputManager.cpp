@@ -1,6 +1,7 @@
 // src/input/InputManager.cpp
 
 #include "InputManager.hpp"
+#include "engine/core/log/Logger.hpp"
 #include <chrono>
 #include <iostream>
 #include <cstdlib>  // for abs
@@ -11,7 +12,7 @@ namespace engine::input {
 
 void InputManager::SetEventManager(engine::event::EventManager* eventManager) {
     eventManager_ = eventManager;
-    std::cout << "[InputManager] Event manager set" << std::endl;
+    LOG_INFO("InputManager") << "Event manager set";
 }
 
 void InputManager::HandleEvent(const SDL_Event& event) {
@@ -20,7 +21,7 @@ void InputManager::HandleEvent(const SDL_Event& event) {
             keyDown_[event.key.key] = true;
             keyHeld_[event.key.key] = true;
             if (event.key.key == SDLK_R) {
-                std::cout << "[InputManager] R key pressed detected!" << std::endl;
+                LOG_DEBUG("InputManager") << "R key pressed detected!";
             }
             PublishKeyEvent(engine::event::EventType::KEY_DOWN, event);
             break;
@@ -32,7 +33,7 @@ void InputManager::HandleEvent(const SDL_Event& event) {
         case SDL_EVENT_MOUSE_BUTTON_DOWN:
             mouseButtonDown_[event.button.button] = true;
             mouseButtonHeld_[event.button.button] = true;
-            std::cout << "[InputManager] Mouse button " << static_cast<int>(event.button.button) << " pressed" << std::endl;
+            LOG_DEBUG("InputManager") << "Mouse button " << static_cast<int>(event.button.button) << " pressed";
             PublishMouseButtonEvent(engine::event::EventType::MOUSE_CLICK, event);
             break;
         case SDL_EVENT_MOUSE_BUTTON_UP:
@@ -47,7 +48,7 @@ void InputManager::HandleEvent(const SDL_Event& event) {
             PublishMouseMotionEvent(event);
             break;
         case SDL_EVENT_FINGER_DOWN:
-            std::cout << "[InputManager] Finger down event detected" << std::endl;
+            LOG_DEBUG("InputManager") << "Finger down event detected";
             {
                 SDL_Event mouseEvent = {};
                 mouseEvent.type = SDL_EVENT_MOUSE_BUTTON_DOWN;
@@ -58,7 +59,7 @@ void InputManager::HandleEvent(const SDL_Event& event) {
             }
             break;
         case SDL_EVENT_FINGER_MOTION:
-            std::cout << "[InputManager] Finger motion event detected" << std::endl;
+            LOG_DEBUG("InputManager") << "Finger motion event detected";
             {
                 SDL_Event mouseEvent = {};
                 mouseEvent.type = SDL_EVENT_MOUSE_MOTION;
@@ -71,7 +72,7 @@ void InputManager::HandleEvent(const SDL_Event& event) {
             break;
         case SDL_EVENT_MOUSE_WHEEL:
             PublishMouseWheelEvent(event);
-            std::cout << "[InputManager] Publishing MOUSE_WHEEL event" << std::endl;
+            LOG_DEBUG("InputManager") << "Publishing MOUSE_WHEEL event";
             break;
         default:
             break;
@@ -107,7 +108,7 @@ bool InputManager::IsMouseButtonDown(Uint8 button) const {
     auto it = mouseButtonDown_.find(button);
     bool result = it != mouseButtonDown_.end() && it->second;
     if (result) {
-        std::cout << "[InputManager] IsMouseButtonDown(" << static_cast<int>(button) << ") = true" << std::endl;
+        LOG_DEBUG_EVERY("InputManager", 1000) << "IsMouseButtonDown(" << static_cast<int>(button) << ") = true";
     }
     return result;
 }
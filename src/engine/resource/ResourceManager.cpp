@@ -1,5 +1,6 @@
 #include "ResourceManager.hpp"
 #include "engine/utils/PathUtils.hpp"
+#include "engine/core/profiling/TraceProfiler.hpp"
 #include <SDL3_image/SDL_image.h>
 #include <iostream>
 
@@ -16,28 +17,67 @@ ResourceManager::~ResourceManager() {
 }
 
 SDL_Texture* ResourceManager::LoadTexture(const std::string& filePath) {
+    CachedTexture* cached = LoadCachedTexture(filePath);
+    return cached ? cached->texture : fallbackTexture_;
+}
+
+TextureHandle ResourceManager::LoadTextureHandle(const std::string& filePath) {
+    CachedTexture* cached = LoadCachedTexture(filePath);
+    if (!cached) {
+        return {};
+    }
+    return {cached->slot, textureSlots_[cached->slot].generation};
+}
+
+TextureHandle ResourceManager::GetTextureHandle(const std::string& filePath) const {
+    std::string fullPath = utils::GetAssetsPath() + filePath;
+    std::string normalizedPath = NormalizePath(fullPath);
+    auto it = textureCache_.find(normalizedPath);
+    if (it == textureCache_.end()) {
+        return {};
+    }
+    return {it->second.slot, textureSlots_[it->second.slot].generation};
+}
+
+ResourceManager::CachedTexture* ResourceManager::LoadCachedTexture(const std::string& filePath) {
+    PROFILE_SCOPE("ResourceManager::LoadTexture");
+
+    if (!renderer_) {
+        return nullptr;  // Headless: nothing to upload to
+    }
+
     std::string fullPath = utils::GetAssetsPath() + filePath;
     std::string normalizedPath = NormalizePath(fullPath);
 
     auto it = textureCache_.find(normalizedPath);
     if (it != textureCache_.end()) {
-        it->second.second += 1; // ref++
+        it->second.refCount += 1; // ref++
         SDL_Log("[ResourceManager] Reusing texture: %s (ref count = %d)", 
-                normalizedPath.c_str(), it->second.second);
-        return it->second.first;
+                normalizedPath.c_str(), it->second.refCount);
+        return &it->second;
     }
 
 #ifdef DEBUG
     auto start = std::chrono::high_resolution_clock::now();
 #endif
 
-    SDL_Texture* texture = IMG_LoadTexture(renderer_, fullPath.c_str());
-    SDL_Log("[ResourceManager] IMG_LoadTexture returned: %p", texture);
+    TextureRegion region;
+    bool packed = false;
+    if (atlas_) {
+        LoadIntoAtlas(fullPath, region, packed);
+    } else {
+        region.texture = IMG_LoadTexture(renderer_, fullPath.c_str());
+        SDL_Log("[ResourceManager] IMG_LoadTexture returned: %p", region.texture);
+        float width = 0.0f, height = 0.0f;
+        if (region.texture && SDL_GetTextureSize(region.texture, &width, &height)) {
+            region.rect = {0, 0, static_cast<int>(width), static_cast<int>(height)};
+        }
+    }
     
-    if (!texture) {
+    if (!region.texture) {
         SDL_Log("[ResourceManager] Failed to load image: %s — %s", 
                 normalizedPath.c_str(), SDL_GetError());
-        return fallbackTexture_;
+        return nullptr;
     }
 
 #ifdef DEBUG
@@ -46,9 +86,59 @@ SDL_Texture* ResourceManager::LoadTexture(const std::string& filePath) {
             std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count());
 #endif
 
-    textureCache_[normalizedPath] = {texture, 1}; // initialize counter at 1
-    SDL_Log("[ResourceManager] Loaded texture: %s (ref count = 1)", normalizedPath.c_str());
-    return texture;
+    auto& cached = textureCache_[normalizedPath];
+    cached = {region.texture, 1, AllocateSlot(region), packed}; // initialize counter at 1
+    textureLoadEpoch_++;
+    SDL_Log("[ResourceManager] Loaded texture: %s (ref count = 1%s)", normalizedPath.c_str(),
+            packed ? ", packed into atlas" : "");
+    return &cached;
+}
+
+void ResourceManager::EnableAtlas(int pageSize, int maxImageSize) {
+    if (!renderer_) {
+        return;  // Headless
+    }
+    atlas_ = std::make_unique<TextureAtlas>(renderer_, pageSize);
+    maxAtlasImageSize_ = maxImageSize > 0 ? maxImageSize : pageSize;
+    SDL_Log("[ResourceManager] Texture atlas enabled (%dx%d pages, images up to %d px)",
+            pageSize, pageSize, maxAtlasImageSize_);
+}
+
+bool ResourceManager::LoadIntoAtlas(const std::string& fullPath, TextureRegion& region, bool& packed) {
+    SDL_Surface* surface = IMG_Load(fullPath.c_str());
+    if (!surface) {
+        return false;
+    }
+
+    packed = surface->w <= maxAtlasImageSize_ && surface->h <= maxAtlasImageSize_ &&
+             atlas_->Add(surface, region.texture, region.rect);
+    if (!packed) {
+        // Too big for the atlas: a texture of its own
+        region.texture = SDL_CreateTextureFromSurface(renderer_, surface);
+        region.rect = {0, 0, surface->w, surface->h};
+    }
+    SDL_DestroySurface(surface);
+    return region.texture != nullptr;
+}
+
+uint32_t ResourceManager::AllocateSlot(const TextureRegion& region) {
+    uint32_t slot;
+    if (!freeSlots_.empty()) {
+        slot = freeSlots_.back();
+        freeSlots_.pop_back();
+    } else {
+        slot = static_cast<uint32_t>(textureSlots_.size());
+        textureSlots_.emplace_back();
+    }
+    textureSlots_[slot].region = region;
+    return slot;
+}
+
+void ResourceManager::FreeSlot(uint32_t slot) {
+    // Outstanding handles to this slot now resolve to null
+    textureSlots_[slot].region = {};
+    textureSlots_[slot].generation++;
+    freeSlots_.push_back(slot);
 }
 
 void ResourceManager::ReleaseTexture(const std::string& filePath) {
@@ -61,18 +151,18 @@ void ResourceManager::ReleaseTexture(const std::string& filePath) {
         return;
     }
 
-    if (it->second.second <= 0) {
+    if (it->second.refCount <= 0) {
         SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
                     "[ResourceManager] Double release detected: %s", normalizedPath.c_str());
         return;
     }
 
-    it->second.second -= 1; // ref--
+    it->second.refCount -= 1; // ref--
     SDL_Log("[ResourceManager] Released texture: %s (ref count = %d)", 
-            normalizedPath.c_str(), it->second.second);
+            normalizedPath.c_str(), it->second.refCount);
 
-    if (it->second.second == 0) {
-        SDL_DestroyTexture(it->second.first);
+    if (it->second.refCount == 0) {
+        DestroyCachedTexture(it->second);
         textureCache_.erase(it);
         SDL_Log("[ResourceManager] Texture destroyed: %s", normalizedPath.c_str());
     }
@@ -83,15 +173,13 @@ SDL_Texture* ResourceManager::UnloadTexture(const std::string& filePath) {
     std::string normalizedPath = NormalizePath(fullPath);
     auto it = textureCache_.find(normalizedPath);
     if (it != textureCache_.end()) {
-        if (it->second.second > 0) {
+        if (it->second.refCount > 0) {
             SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
                         "[ResourceManager] WARNING: Force-unloading texture with ref count > 0: %s (ref = %d)",
-                        normalizedPath.c_str(), it->second.second);
+                        normalizedPath.c_str(), it->second.refCount);
         }
 
-        if (it->second.first) {
-            SDL_DestroyTexture(it->second.first);
-        }
+        DestroyCachedTexture(it->second);
         textureCache_.erase(it);
     }
     return nullptr;
@@ -101,7 +189,15 @@ SDL_Texture* ResourceManager::GetTexture(const std::string& filePath) const {
     std::string fullPath = utils::GetAssetsPath() + filePath;
     std::string normalizedPath = NormalizePath(fullPath);
     auto it = textureCache_.find(normalizedPath);
-    return (it != textureCache_.end()) ? it->second.first : nullptr;
+    return (it != textureCache_.end()) ? it->second.texture : nullptr;
+}
+
+void ResourceManager::DestroyCachedTexture(CachedTexture& cached) {
+    // Atlas pages stay until UnloadAll(); only the region is given up
+    if (cached.texture && !cached.packed) {
+        SDL_DestroyTexture(cached.texture);
+    }
+    FreeSlot(cached.slot);
 }
 
 std::string ResourceManager::NormalizePath(const std::string& path) const {
@@ -117,18 +213,19 @@ void ResourceManager::UnloadAll() {
     SDL_Log("[ResourceManager] UnloadAll called, cache size: %zu", textureCache_.size());
     
     for (auto& pair : textureCache_) {
-        if (pair.second.first) {
-            SDL_DestroyTexture(pair.second.first);
-        }
+        DestroyCachedTexture(pair.second);
     }
     textureCache_.clear();
+    if (atlas_) {
+        atlas_->Clear();
+    }
     SDL_Log("[ResourceManager] UnloadAll completed");
 }
 
 void ResourceManager::PrintCacheStatus() const {
     SDL_Log("---- [ResourceManager] Texture Cache Status ----");
     for (const auto& pair : textureCache_) {
-        SDL_Log("  %s → ref count = %d", pair.first.c_str(), pair.second.second);
+        SDL_Log("  %s → ref count = %d", pair.first.c_str(), pair.second.refCount);
     }
     SDL_Log("------------------------------------------------");
 }
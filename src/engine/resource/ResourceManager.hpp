@@ -1,13 +1,23 @@
 // src/resources/ResourceManager.hpp
 #pragma once
 
+#include "TextureHandle.hpp"
+#include "TextureAtlas.hpp"
 #include <SDL3/SDL.h>
+#include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 
 namespace engine::resources {
 
+// Where a loaded image lives: its own texture, or a sub-rect of an atlas page
+struct TextureRegion {
+    SDL_Texture* texture = nullptr;
+    SDL_Rect rect = {0, 0, 0, 0};
+};
+
 class ResourceManager {
 public:
     ResourceManager(SDL_Renderer* renderer);
@@ -23,6 +33,31 @@ public:
     SDL_Texture* UnloadTexture(const std::string& filePath);  
 
     SDL_Texture* GetTexture(const std::string& filePath) const;
+
+    // Handles resolve with one array index; look them up once (when a sprite
+    // is created or changes texture), not per frame. LoadTextureHandle()
+    // takes a reference like LoadTexture(); an invalid handle means the
+    // texture isn't loaded.
+    TextureHandle LoadTextureHandle(const std::string& filePath);
+    TextureHandle GetTextureHandle(const std::string& filePath) const;
+    const TextureRegion* GetTextureRegion(TextureHandle handle) const {
+        if (handle.index >= textureSlots_.size()) return nullptr;
+        const auto& slot = textureSlots_[handle.index];
+        return slot.generation == handle.generation && slot.region.texture ? &slot.region : nullptr;
+    }
+    SDL_Texture* GetTexture(TextureHandle handle) const {
+        const TextureRegion* region = GetTextureRegion(handle);
+        return region ? region->texture : nullptr;
+    }
+    // Bumped by every texture load; see TextureHandle::Missing()
+    uint32_t GetTextureLoadEpoch() const { return textureLoadEpoch_; }
+
+    // Packs images loaded from now on (up to maxImageSize on a side, 0 = a
+    // full page) into shared atlas pages. A packed image's texture is its
+    // page, so draw it through its TextureRegion; the path-based
+    // GetTexture()/LoadTexture() then return the whole page.
+    void EnableAtlas(int pageSize = TextureAtlas::DEFAULT_PAGE_SIZE, int maxImageSize = 0);
+    bool IsAtlasEnabled() const { return atlas_ != nullptr; }
     std::string NormalizePath(const std::string& path) const;
 
     void SetFallbackTexture(SDL_Texture* texture);
@@ -34,7 +69,29 @@ private:
     // Pointer to the external SDL renderer, used for creating and managing textures
     SDL_Renderer* renderer_;
     SDL_Texture* fallbackTexture_ = nullptr;
-    std::unordered_map<std::string, std::pair<SDL_Texture*, int>> textureCache_;
+    struct CachedTexture {
+        SDL_Texture* texture;
+        int refCount;
+        uint32_t slot;
+        bool packed;  // Lives in an atlas page, which it doesn't own
+    };
+    struct TextureSlot {
+        TextureRegion region;
+        uint32_t generation = 1;  // Bumped on unload; handles start at 0 = invalid
+    };
+
+    CachedTexture* LoadCachedTexture(const std::string& filePath);
+    bool LoadIntoAtlas(const std::string& fullPath, TextureRegion& region, bool& packed);
+    uint32_t AllocateSlot(const TextureRegion& region);
+    void FreeSlot(uint32_t slot);
+    void DestroyCachedTexture(CachedTexture& cached);
+
+    std::unordered_map<std::string, CachedTexture> textureCache_;
+    std::vector<TextureSlot> textureSlots_ = std::vector<TextureSlot>(1);  // Slot 0 reserved
+    std::vector<uint32_t> freeSlots_;
+    uint32_t textureLoadEpoch_ = 1;
+    std::unique_ptr<TextureAtlas> atlas_;
+    int maxAtlasImageSize_ = 0;
     
 };
 
@@ -0,0 +1,172 @@
+// src/engine/resource/TextureAtlas.cpp
+
+#include "TextureAtlas.hpp"
+#include "engine/core/log/Logger.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+namespace engine::resources {
+
+TextureAtlas::TextureAtlas(SDL_Renderer* renderer, int pageSize)
+    : renderer_(renderer)
+    , pageSize_(pageSize) {
+}
+
+TextureAtlas::~TextureAtlas() {
+    Clear();
+}
+
+bool TextureAtlas::Add(SDL_Surface* image, SDL_Texture*& page, SDL_Rect& rect) {
+    if (!image || !renderer_) {
+        return false;
+    }
+    int paddedWidth = image->w + PADDING;
+    int paddedHeight = image->h + PADDING;
+    if (paddedWidth > pageSize_ || paddedHeight > pageSize_) {
+        return false;
+    }
+
+    // First page with room, else a fresh one
+    size_t pageIndex = pages_.size();
+    int x = 0, y = 0;
+    size_t node = 0;
+    for (size_t i = 0; i < pages_.size(); ++i) {
+        if (FindPosition(pages_[i], paddedWidth, paddedHeight, x, y, node)) {
+            pageIndex = i;
+            break;
+        }
+    }
+    if (pageIndex == pages_.size()) {
+        if (!CreatePage() || !FindPosition(pages_.back(), paddedWidth, paddedHeight, x, y, node)) {
+            return false;
+        }
+    }
+
+    SDL_Surface* pixels = image;
+    if (image->format != SDL_PIXELFORMAT_RGBA32) {
+        pixels = SDL_ConvertSurface(image, SDL_PIXELFORMAT_RGBA32);
+        if (!pixels) {
+            return false;
+        }
+    }
+
+    Page& target = pages_[pageIndex];
+    rect = {x, y, image->w, image->h};
+    bool uploaded = SDL_UpdateTexture(target.texture, &rect, pixels->pixels, pixels->pitch);
+    if (pixels != image) {
+        SDL_DestroySurface(pixels);
+    }
+    if (!uploaded) {
+        LOG_ERROR("TextureAtlas") << "Failed to upload image: " << SDL_GetError();
+        return false;
+    }
+
+    Insert(target, node, x, y, paddedWidth, paddedHeight);
+    page = target.texture;
+    return true;
+}
+
+void TextureAtlas::Clear() {
+    for (auto& page : pages_) {
+        if (page.texture) {
+            SDL_DestroyTexture(page.texture);
+        }
+    }
+    pages_.clear();
+}
+
+bool TextureAtlas::CreatePage() {
+    SDL_Texture* texture = SDL_CreateTexture(renderer_, SDL_PIXELFORMAT_RGBA32,
+                                             SDL_TEXTUREACCESS_STATIC, pageSize_, pageSize_);
+    if (!texture) {
+        LOG_ERROR("TextureAtlas") << "Failed to create " << pageSize_ << "x" << pageSize_
+                                  << " page: " << SDL_GetError();
+        return false;
+    }
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+
+    // Static textures start undefined; padding must read as transparent
+    constexpr int STRIP_ROWS = 64;
+    std::vector<uint32_t> zeros(static_cast<size_t>(pageSize_) * STRIP_ROWS, 0);
+    for (int row = 0; row < pageSize_; row += STRIP_ROWS) {
+        SDL_Rect strip = {0, row, pageSize_, std::min(STRIP_ROWS, pageSize_ - row)};
+        SDL_UpdateTexture(texture, &strip, zeros.data(), pageSize_ * static_cast<int>(sizeof(uint32_t)));
+    }
+
+    Page page;
+    page.texture = texture;
+    page.skyline.push_back({0, 0, pageSize_});
+    pages_.push_back(std::move(page));
+
+    LOG_INFO("TextureAtlas") << "Created page " << pages_.size() << " (" << pageSize_ << "x" << pageSize_ << ")";
+    return true;
+}
+
+bool TextureAtlas::FindPosition(const Page& page, int width, int height, int& bestX, int& bestY, size_t& bestNode) const {
+    int bestTop = std::numeric_limits<int>::max();
+    int bestWidth = std::numeric_limits<int>::max();
+    bool found = false;
+
+    const auto& skyline = page.skyline;
+    for (size_t i = 0; i < skyline.size(); ++i) {
+        int x = skyline[i].x;
+        if (x + width > pageSize_) {
+            break;  // Nodes are sorted by x
+        }
+
+        // Rest on the highest node the rect spans
+        int y = 0;
+        int widthLeft = width;
+        for (size_t j = i; widthLeft > 0; ++j) {
+            y = std::max(y, skyline[j].y);
+            widthLeft -= skyline[j].width;
+        }
+        if (y + height > pageSize_) {
+            continue;
+        }
+
+        // Lowest top edge wins; ties go to the narrower node (less waste)
+        if (y + height < bestTop || (y + height == bestTop && skyline[i].width < bestWidth)) {
+            bestTop = y + height;
+            bestWidth = skyline[i].width;
+            bestX = x;
+            bestY = y;
+            bestNode = i;
+            found = true;
+        }
+    }
+    return found;
+}
+
+void TextureAtlas::Insert(Page& page, size_t node, int x, int y, int width, int height) {
+    auto& skyline = page.skyline;
+    skyline.insert(skyline.begin() + node, {x, y + height, width});
+
+    // Trim or drop the nodes now under the new one
+    for (size_t i = node + 1; i < skyline.size();) {
+        int coveredTo = skyline[i - 1].x + skyline[i - 1].width;
+        if (skyline[i].x >= coveredTo) {
+            break;
+        }
+        int shrink = coveredTo - skyline[i].x;
+        skyline[i].x += shrink;
+        skyline[i].width -= shrink;
+        if (skyline[i].width > 0) {
+            break;
+        }
+        skyline.erase(skyline.begin() + i);
+    }
+
+    // Merge neighbours at the same height
+    for (size_t i = 0; i + 1 < skyline.size();) {
+        if (skyline[i].y == skyline[i + 1].y) {
+            skyline[i].width += skyline[i + 1].width;
+            skyline.erase(skyline.begin() + i + 1);
+        } else {
+            ++i;
+        }
+    }
+}
+
+} // namespace engine::resources
@@ -0,0 +1,58 @@
+// src/engine/resource/TextureAtlas.hpp
+
+#pragma once
+
+#include <SDL3/SDL.h>
+#include <cstddef>
+#include <vector>
+
+namespace engine::resources {
+
+// Packs images into a few large texture pages so sprites from different
+// images can share one texture (and one SpriteBatch draw call). Each page is
+// filled with a skyline bottom-left packer; an image that fits no existing
+// page opens a new one. Pages live until Clear(); packed images are never
+// freed individually.
+class TextureAtlas {
+public:
+    static constexpr int DEFAULT_PAGE_SIZE = 2048;
+    static constexpr int PADDING = 1;  // Transparent gap against filtering bleed
+
+    TextureAtlas(SDL_Renderer* renderer, int pageSize = DEFAULT_PAGE_SIZE);
+    ~TextureAtlas();
+
+    TextureAtlas(const TextureAtlas&) = delete;
+    TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+    // Copies image into a page; on success page/rect say where it went.
+    // Fails if the image is larger than a page or the upload fails.
+    bool Add(SDL_Surface* image, SDL_Texture*& page, SDL_Rect& rect);
+
+    void Clear();
+
+    int GetPageSize() const { return pageSize_; }
+    size_t GetPageCount() const { return pages_.size(); }
+
+private:
+    struct SkylineNode {
+        int x;
+        int y;
+        int width;
+    };
+
+    struct Page {
+        SDL_Texture* texture = nullptr;
+        std::vector<SkylineNode> skyline;
+    };
+
+    bool CreatePage();
+    // Best bottom-left position for a w x h rect; false if it doesn't fit
+    bool FindPosition(const Page& page, int width, int height, int& bestX, int& bestY, size_t& bestNode) const;
+    void Insert(Page& page, size_t node, int x, int y, int width, int height);
+
+    SDL_Renderer* renderer_;
+    int pageSize_;
+    std::vector<Page> pages_;
+};
+
+} // namespace engine::resources
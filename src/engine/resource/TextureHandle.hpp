@@ -0,0 +1,31 @@
+// src/engine/resource/TextureHandle.hpp
+
+#pragma once
+
+#include <cstdint>
+
+namespace engine::resources {
+
+// Stable reference to a texture loaded by ResourceManager: a slot index plus
+// the slot's generation, so a handle to an unloaded texture resolves to null
+// instead of whatever reused the slot. Index 0 is never handed out.
+struct TextureHandle {
+    uint32_t index = 0;
+    uint32_t generation = 0;
+
+    bool IsValid() const { return index != 0; }
+
+    // An invalid handle can record a failed lookup instead: Missing(epoch)
+    // means "not loaded as of ResourceManager::GetTextureLoadEpoch() ==
+    // epoch", so the path needn't be looked up again until something else
+    // loads. Epochs start at 1; resetting to {} clears the mark.
+    static TextureHandle Missing(uint32_t loadEpoch) { return {0, loadEpoch}; }
+    bool IsMissingAsOf(uint32_t loadEpoch) const { return index == 0 && generation == loadEpoch; }
+
+    bool operator==(const TextureHandle& other) const {
+        return index == other.index && generation == other.generation;
+    }
+    bool operator!=(const TextureHandle& other) const { return !(*this == other); }
+};
+
+} // namespace engine::resources
@@ -28,8 +28,8 @@
 
 // 系统
 #include "ecs/systems/GroundRenderSystem.hpp"
+#include "engine/core/log/Logger.hpp"
 
-#include <iostream>
 
 namespace ZombieSurvivor {
 
@@ -37,15 +37,15 @@ GameScene::GameScene(const std::string& id,
                      engine::input::InputManager* inputManager,
                      engine::resources::ResourceManager* resourceManager) 
     : sceneId_(id), inputManager_(inputManager), resourceManager_(resourceManager) {
-    std::cout << "[GameScene] Created with ID: " << sceneId_ << std::endl;
+    LOG_INFO("GameScene") << "Created with ID: " << sceneId_;
 }
 
 void GameScene::Load() {
-    std::cout << "[GameScene] Loading scene..." << std::endl;
+    LOG_INFO("GameScene") << "Loading scene...";
     
     world_ = GetWorld();  
     if (!world_) {
-        std::cout << "[GameScene] ERROR: No World provided by Engine!" << std::endl;
+        LOG_ERROR("GameScene") << "No World provided by Engine!";
         return;
     }
     
@@ -55,18 +55,18 @@ void GameScene::Load() {
     CreateEntities();
     SetupGameWorldViewport();
     
-    std::cout << "[GameScene] Scene loaded successfully!" << std::endl;
+    LOG_INFO("GameScene") << "Scene loaded successfully!";
 }
 
 void GameScene::Unload() {
-    std::cout << "[GameScene] Unloading scene..." << std::endl;
+    LOG_INFO("GameScene") << "Unloading scene...";
     
     if (world_) {
         world_->GetSystemManager().ClearAllSystems();
         world_->ClearAllEntities();
     }
     
-    std::cout << "[GameScene] Scene unloaded." << std::endl;
+    LOG_INFO("GameScene") << "Scene unloaded.";
 }
 
 void GameScene::Update(float deltaTime) {
@@ -83,7 +83,7 @@ void GameScene::Render(SDL_Renderer* renderer) {
 void GameScene::HandleEvent(const SDL_Event& event) {
     if (event.type == SDL_EVENT_KEY_DOWN) {
         if (event.key.key == SDLK_ESCAPE) {
-            std::cout << "[GameScene] ESC pressed - requesting quit" << std::endl;
+            LOG_INFO("GameScene") << "ESC pressed - requesting quit";
             
             SDL_Event quitEvent;
             quitEvent.type = SDL_EVENT_QUIT;
@@ -105,11 +105,11 @@ void GameScene::SetInputManager(engine::input::InputManager* manager) {
 }
 
 void GameScene::InitializeSystems() {
-    std::cout << "[GameScene] Initializing systems..." << std::endl;
+    LOG_INFO("GameScene") << "Initializing systems...";
     
     world_ = GetWorld();  
     if (!world_) {
-        std::cout << "[GameScene] ERROR: No World provided by Engine!" << std::endl;
+        LOG_ERROR("GameScene") << "No World provided by Engine!";
         return;
     }
     
@@ -128,7 +128,7 @@ void GameScene::InitializeSystems() {
         collisionSystem->SetCollisionRule("projectile", "enemy", true);
         collisionSystem->SetCollisionRule("player", "projectile", false);
         
-        std::cout << "[GameScene] Collision rules configured!" << std::endl;
+        LOG_INFO("GameScene") << "Collision rules configured!";
     }
     
     auto groundSystem = std::make_unique<System::GroundRenderSystem>();
@@ -194,14 +194,14 @@ void GameScene::InitializeSystems() {
     hudRenderSystem->SetScreenSize(1312, 982); // Set correct window dimensions
     systemManager.AddSystem(std::move(hudRenderSystem), 55); // After HUDDataSystem and RenderSystem
     
-    std::cout << "[GameScene] Systems initialized successfully!" << std::endl;
+    LOG_INFO("GameScene") << "Systems initialized successfully!";
 }
 
 void GameScene::CreateEntities() {
-    std::cout << "[GameScene] Creating game entities..." << std::endl;
+    LOG_INFO("GameScene") << "Creating game entities...";
     
     if (!world_) {
-        std::cout << "[GameScene] Error: World not available!" << std::endl;
+        LOG_ERROR("GameScene") << "World not available!";
         return;
     }
     
@@ -216,11 +216,11 @@ void GameScene::CreateEntities() {
         weaponId_ = gameEntityFactory_->CreateWeapon(playerId_);
 
         hudId_ = gameEntityFactory_->CreatePlayerHUD(playerId_);
-        std::cout << "[GameScene] Created HUD for player " << playerId_ 
-                  << ", HUD ID: " << hudId_ << std::endl;
+        LOG_INFO("GameScene") << "Created HUD for player " << playerId_ 
+                              << ", HUD ID: " << hudId_;
     }
     
-    std::cout << "[GameScene] Game entities created!" << std::endl;
+    LOG_INFO("GameScene") << "Game entities created!";
 }
 
 void GameScene::SetupGameWorldViewport() {
@@ -240,10 +240,15 @@ void GameScene::SetupGameWorldViewport() {
     
     if (renderSystem) {
         renderSystem->SetGameWorldViewport(offsetX, offsetY, GAME_WORLD_WIDTH, GAME_WORLD_HEIGHT);
-        std::cout << "[GameScene] Game world viewport set: offset(" << offsetX << ", " << offsetY 
-                  << "), size(" << GAME_WORLD_WIDTH << "x" << GAME_WORLD_HEIGHT << ")" << std::endl;
+        // Index a band around the arena too, where enemies spawn
+        const float CULL_BAND = 256.0f;
+        renderSystem->EnableViewCulling({-CULL_BAND, -CULL_BAND,
+                                         GAME_WORLD_WIDTH + CULL_BAND * 2.0f,
+                                         GAME_WORLD_HEIGHT + CULL_BAND * 2.0f});
+        LOG_INFO("GameScene") << "Game world viewport set: offset(" << offsetX << ", " << offsetY 
+                              << "), size(" << GAME_WORLD_WIDTH << "x" << GAME_WORLD_HEIGHT << ")";
     } else {
-        std::cout << "[GameScene] WARNING: RenderSystem not found, viewport not set!" << std::endl;
+        LOG_WARN("GameScene") << "RenderSystem not found, viewport not set!";
     }
 }
 
@@ -23,7 +23,7 @@
 #include "engine/core/ecs/components/AnimationState.hpp"
 #include "engine/core/ecs/components/SpriteStateComponent.hpp"
 #include "engine/animation/SpriteSheetLoader.hpp"
-#include <iostream>
+#include "engine/core/log/Logger.hpp"
 #include <cmath>
 
 namespace ZombieSurvivor::ECS {
@@ -217,14 +217,14 @@ uint32_t GameEntityFactory::CreatePlayer(const engine::Vector2& position) {
     auto* expCheck = componentManager.GetComponent<ZombieSurvivor::Component::ExperienceComponent>(playerId);
     
     if (healthCheck) {
-        std::cout << "[GameEntityFactory] Player " << playerId << " health: " 
-                  << healthCheck->health << "/" << healthCheck->maxHealth << std::endl;
+        LOG_INFO("GameEntityFactory") << "Player " << playerId << " health: " 
+                                      << healthCheck->health << "/" << healthCheck->maxHealth;
     }
     
     if (expCheck) {
-        std::cout << "[GameEntityFactory] Player " << playerId << " experience: " 
-                  << expCheck->experience << "/" << expCheck->experienceToNext 
-                  << " (Level " << expCheck->level << ")" << std::endl;
+        LOG_INFO("GameEntityFactory") << "Player " << playerId << " experience: " 
+                                      << expCheck->experience << "/" << expCheck->experienceToNext 
+                                      << " (Level " << expCheck->level << ")";
     }
     
     // Adding "Player" Tag to player
@@ -243,13 +243,13 @@ uint32_t GameEntityFactory::CreatePlayer(const engine::Vector2& position) {
     // DEBUG: Verify ammo was set correctly
     auto* ammoCheck = componentManager.GetComponent<ZombieSurvivor::Component::AmmoComponent>(playerId);
     if (ammoCheck) {
-        std::cout << "[GameEntityFactory] Player " << playerId << " ammo after creation: " 
-                  << ammoCheck->currentAmmo << "/" << ammoCheck->totalAmmo << " (max: " << ammoCheck->maxTotalAmmo << ")" << std::endl;
+        LOG_INFO("GameEntityFactory") << "Player " << playerId << " ammo after creation: " 
+                                      << ammoCheck->currentAmmo << "/" << ammoCheck->totalAmmo << " (max: " << ammoCheck->maxTotalAmmo << ")";
     } else {
-        std::cout << "[GameEntityFactory] ERROR: Player " << playerId << " has no AmmoComponent after creation!" << std::endl;
+        LOG_ERROR("GameEntityFactory") << "Player " << playerId << " has no AmmoComponent after creation!";
     }
     
-    std::cout << "[GameEntityFactory] Created player entity: " << playerId << std::endl;
+    LOG_INFO("GameEntityFactory") << "Created player entity: " << playerId;
     return playerId;
 }
 
@@ -262,7 +262,7 @@ uint32_t GameEntityFactory::CreateWeapon(engine::EntityID playerEntityId, const
     // Get player position for initial weapon position
     auto* playerTransform = componentManager.GetComponent<engine::ECS::Transform2D>(playerEntityId);
     if (!playerTransform) {
-        std::cout << "[GameEntityFactory] ERROR: Player entity not found for weapon creation" << std::endl;
+        LOG_ERROR("GameEntityFactory") << "Player entity not found for weapon creation";
         return 0;
     }
     
@@ -334,19 +334,19 @@ uint32_t GameEntityFactory::CreateWeapon(engine::EntityID playerEntityId, const
     componentManager.AddComponent<engine::ECS::Tag>(weaponId, 
         engine::ECS::Tag{"weapon"});
     
-    std::cout << "[GameEntityFactory] Created weapon entity: " << weaponId << " for player: " << playerEntityId << std::endl;
+    LOG_INFO("GameEntityFactory") << "Created weapon entity: " << weaponId << " for player: " << playerEntityId;
     return weaponId;
 }
 
 uint32_t GameEntityFactory::CreatePlayerHUD(engine::EntityID playerEntityId) {
-    std::cout << "[GameEntityFactory] *** CreatePlayerHUD called for player " << playerEntityId << " ***" << std::endl;
+    LOG_INFO("GameEntityFactory") << "*** CreatePlayerHUD called for player " << playerEntityId << " ***";
     
     if (!ValidateWorld()) {
-        std::cout << "[GameEntityFactory] ERROR: World validation failed!" << std::endl;
+        LOG_ERROR("GameEntityFactory") << "World validation failed!";
         return 0;
     }
     
-    std::cout << "[GameEntityFactory] World validation passed" << std::endl;
+    LOG_INFO("GameEntityFactory") << "World validation passed";
     
     if (!ValidateWorld()) return 0;
 
@@ -390,7 +390,7 @@ uint32_t GameEntityFactory::CreatePlayerHUD(engine::EntityID playerEntityId) {
     componentManager.AddComponent<engine::ECS::Tag>(healthHudId, 
         engine::ECS::Tag{"player_health_hud"});
     
-    std::cout << "[GameEntityFactory] Created player health HUD: " << healthHudId << std::endl;
+    LOG_INFO("GameEntityFactory") << "Created player health HUD: " << healthHudId;
 
     engine::EntityID expHudId = entityFactory.CreateEntity("PlayerExperienceHUD");
     
@@ -430,7 +430,7 @@ uint32_t GameEntityFactory::CreatePlayerHUD(engine::EntityID playerEntityId) {
     componentManager.AddComponent<engine::ECS::Tag>(expHudId, 
         engine::ECS::Tag{"player_experience_hud"});
     
-    std::cout << "[GameEntityFactory] Created player experience HUD: " << expHudId << std::endl;
+    LOG_INFO("GameEntityFactory") << "Created player experience HUD: " << expHudId;
 
     // Create Ammo Counter HUD (positioned in bottom-right area)
     engine::EntityID ammoHudId = entityFactory.CreateEntity("PlayerAmmoHUD");
@@ -471,15 +471,15 @@ uint32_t GameEntityFactory::CreatePlayerHUD(engine::EntityID playerEntityId) {
     componentManager.AddComponent<engine::ECS::Tag>(ammoHudId, 
         engine::ECS::Tag{"player_ammo_hud"});
     
-    std::cout << "[GameEntityFactory] Created player ammo HUD: " << ammoHudId 
-              << " at position (" << ammoHUD.bounds.x << ", " << ammoHUD.bounds.y << ")" << std::endl;
+    LOG_INFO("GameEntityFactory") << "Created player ammo HUD: " << ammoHudId 
+                                  << " at position (" << ammoHUD.bounds.x << ", " << ammoHUD.bounds.y << ")";
     
-    std::cout << "[GameEntityFactory] All HUD elements created successfully!" << std::endl;
-    std::cout << "[GameEntityFactory] Health HUD created with bounds: " 
+    LOG_INFO("GameEntityFactory") << "All HUD elements created successfully!";
+    LOG_INFO("GameEntityFactory") << "Health HUD created with bounds: " 
     << healthHUD.bounds.x << "," << healthHUD.bounds.y << " " 
-    << healthHUD.bounds.w << "x" << healthHUD.bounds.h << std::endl;
-    std::cout << "[GameEntityFactory] Health HUD values: " 
-    << healthHUD.currentValue << "/" << healthHUD.maxValue << std::endl;
+    << healthHUD.bounds.w << "x" << healthHUD.bounds.h;
+    LOG_INFO("GameEntityFactory") << "Health HUD values: " 
+    << healthHUD.currentValue << "/" << healthHUD.maxValue;
     return healthHudId;
 }
 
@@ -614,7 +614,7 @@ uint32_t GameEntityFactory::CreateZombie(const engine::Vector2& position) {
     componentManager.AddComponent<Component::TargetComponent>(zombie, Component::TargetComponent{});
     componentManager.AddComponent<engine::ECS::Tag>(zombie, engine::ECS::Tag{"enemy"});
     
-    std::cout << "[GameEntityFactory] Created complete zombie entity: " << zombie << std::endl;
+    LOG_INFO("GameEntityFactory") << "Created complete zombie entity: " << zombie;
     return zombie;
 }
 
@@ -654,7 +654,7 @@ uint32_t GameEntityFactory::CreateProjectile(const engine::Vector2& position,
             1.0f                                 // no friction factor
         });
     
-    std::cout << "[GameEntityFactory] Created projectile: " << projectileId << std::endl;
+    LOG_INFO("GameEntityFactory") << "Created projectile: " << projectileId;
     return projectileId;
 }
 
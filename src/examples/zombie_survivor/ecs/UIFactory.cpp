@@ -1,13 +1,13 @@
 // src/examples/zombie_survivor/ecs/UIFactory.cpp
 
 #include "UIFactory.hpp"
-#include <iostream>
+#include "engine/core/log/Logger.hpp"
 
 namespace ZombieSurvivor::ECS {
 
 UIFactory::UIFactory(engine::ECS::World* world) : world_(world) {
     if (!ValidateWorld()) {
-        std::cerr << "[UIFactory] Error: Invalid world provided to UIFactory" << std::endl;
+        LOG_ERROR("UIFactory") << "Invalid world provided to UIFactory";
     }
 }
 
@@ -30,7 +30,7 @@ uint32_t UIFactory::CreateHealthHUD(uint32_t targetPlayerId, Component::HUDPosit
         hud->animationSpeed = 5.0f;
     }
     
-    std::cout << "[UIFactory] Created health HUD for player " << targetPlayerId << std::endl;
+    LOG_INFO("UIFactory") << "Created health HUD for player " << targetPlayerId;
     return hudEntityId;
 }
 
@@ -53,7 +53,7 @@ uint32_t UIFactory::CreateAmmoHUD(uint32_t targetPlayerId, Component::HUDPositio
         hud->animationSpeed = 8.0f;
     }
     
-    std::cout << "[UIFactory] Created ammo HUD for player " << targetPlayerId << std::endl;
+    LOG_INFO("UIFactory") << "Created ammo HUD for player " << targetPlayerId;
     return hudEntityId;
 }
 
@@ -76,7 +76,7 @@ uint32_t UIFactory::CreateExperienceHUD(uint32_t targetPlayerId, Component::HUDP
         hud->animationSpeed = 10.0f;
     }
     
-    std::cout << "[UIFactory] Created experience HUD for player " << targetPlayerId << std::endl;
+    LOG_INFO("UIFactory") << "Created experience HUD for player " << targetPlayerId;
     return hudEntityId;
 }
 
@@ -98,7 +98,7 @@ uint32_t UIFactory::CreateKillCounterHUD(uint32_t targetPlayerId, Component::HUD
         hud->updateInterval = 0.2f;
     }
     
-    std::cout << "[UIFactory] Created kill counter HUD for player " << targetPlayerId << std::endl;
+    LOG_INFO("UIFactory") << "Created kill counter HUD for player " << targetPlayerId;
     return hudEntityId;
 }
 
@@ -117,7 +117,7 @@ uint32_t UIFactory::CreateSurvivalTimerHUD(Component::HUDPosition position) {
         hud->updateInterval = 1.0f;                     // Update every second
     }
     
-    std::cout << "[UIFactory] Created survival timer HUD" << std::endl;
+    LOG_INFO("UIFactory") << "Created survival timer HUD";
     return hudEntityId;
 }
 
@@ -135,7 +135,7 @@ uint32_t UIFactory::CreateCrosshairHUD(Component::HUDPosition position) {
         hud->animateChanges = false;
     }
     
-    std::cout << "[UIFactory] Created crosshair HUD" << std::endl;
+    LOG_INFO("UIFactory") << "Created crosshair HUD";
     return hudEntityId;
 }
 
@@ -155,7 +155,7 @@ uint32_t UIFactory::CreateButton(const std::string& text, SDL_Rect bounds, std::
         ui->fontSize = 16;
     }
     
-    std::cout << "[UIFactory] Created button: " << text << std::endl;
+    LOG_INFO("UIFactory") << "Created button: " << text;
     return uiEntityId;
 }
 
@@ -172,7 +172,7 @@ uint32_t UIFactory::CreateLabel(const std::string& text, SDL_Rect bounds) {
         ui->fontSize = 14;
     }
     
-    std::cout << "[UIFactory] Created label: " << text << std::endl;
+    LOG_INFO("UIFactory") << "Created label: " << text;
     return uiEntityId;
 }
 
@@ -187,7 +187,7 @@ uint32_t UIFactory::CreatePanel(SDL_Rect bounds, SDL_Color backgroundColor) {
         ui->text = "";
     }
     
-    std::cout << "[UIFactory] Created panel" << std::endl;
+    LOG_INFO("UIFactory") << "Created panel";
     return uiEntityId;
 }
 
@@ -203,7 +203,7 @@ uint32_t UIFactory::CreateProgressBar(SDL_Rect bounds, float progress) {
         ui->progressColor = {0, 255, 0, 255};           // Green progress
     }
     
-    std::cout << "[UIFactory] Created progress bar" << std::endl;
+    LOG_INFO("UIFactory") << "Created progress bar";
     return uiEntityId;
 }
 
@@ -354,7 +354,7 @@ bool UIFactory::ValidateTargetEntity(uint32_t targetEntityId) const {
     if (!ValidateWorld()) return false;
     
     if (targetEntityId == 0) {
-        std::cout << "[UIFactory] Warning: Target entity ID is 0" << std::endl;
+        LOG_WARN("UIFactory") << "Target entity ID is 0";
         return true; // Allow 0 for some HUD elements like timer
     }
     
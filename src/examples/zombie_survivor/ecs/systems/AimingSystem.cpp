@@ -2,12 +2,12 @@
 
 #include "AimingSystem.hpp"
 #include "engine/core/ecs/World.hpp"
-#include <iostream>
+#include "engine/core/log/Logger.hpp"
 
 namespace ZombieSurvivor::System {
 
 void AimingSystem::Init() {
-    std::cout << "[AimingSystem] Initialized" << std::endl;
+    LOG_INFO("AimingSystem") << "Initialized";
 }
 
 void AimingSystem::Update(float deltaTime) {
@@ -33,7 +33,7 @@ void AimingSystem::Update(float deltaTime) {
 }
 
 void AimingSystem::Shutdown() {
-    std::cout << "[AimingSystem] Shutdown" << std::endl;
+    LOG_INFO("AimingSystem") << "Shutdown";
 }
 
 void AimingSystem::UpdateAiming(uint32_t entityId) {
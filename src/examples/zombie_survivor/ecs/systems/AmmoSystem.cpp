@@ -5,7 +5,7 @@
 #include "engine/core/event/EventManager.hpp"
 #include "examples/zombie_survivor/events/GameEventData.hpp"
 #include "examples/zombie_survivor/ecs/components/WeaponComponent.hpp"
-#include <iostream>
+#include "engine/core/log/Logger.hpp"
 #include <algorithm>
 #include <unordered_map>
 
@@ -18,7 +18,7 @@ void AmmoSystem::Init() {
     auto& eventManager = world->GetEventManager();
     eventManager.Subscribe(engine::event::EventType::CUSTOM, this);
 
-    std::cout << "[AmmoSystem] Initialized" << std::endl;
+    LOG_INFO("AmmoSystem") << "Initialized";
 }
 
 void AmmoSystem::Update(float deltaTime) {
@@ -34,7 +34,7 @@ void AmmoSystem::Shutdown() {
     auto& eventManager = world->GetEventManager();
     eventManager.Unsubscribe(engine::event::EventType::CUSTOM, this);
     
-    std::cout << "[AmmoSystem] Shutdown" << std::endl;
+    LOG_INFO("AmmoSystem") << "Shutdown";
 }
 
 void AmmoSystem::onEvent(const std::shared_ptr<engine::event::Event>& event) {
@@ -76,8 +76,8 @@ void AmmoSystem::ConsumeAmmo(uint32_t entityId, int amount) {
         PublishAmmoDepletedEvent(entityId);
     }
     
-    std::cout << "[AmmoSystem] Entity " << entityId << " consumed " << amount 
-              << " ammo, remaining: " << ammo->currentAmmo << "/" << ammo->totalAmmo << std::endl;
+    LOG_DEBUG("AmmoSystem") << "Entity " << entityId << " consumed " << amount 
+                           << " ammo, remaining: " << ammo->currentAmmo << "/" << ammo->totalAmmo;
 }
 
 void AmmoSystem::AddAmmo(uint32_t entityId, int amount) {
@@ -99,8 +99,8 @@ void AmmoSystem::AddAmmo(uint32_t entityId, int amount) {
     // 发布弹药变化事件
     PublishAmmoChangedEvent(entityId, oldCurrent, oldTotal, ammo->currentAmmo, ammo->totalAmmo);
     
-    std::cout << "[AmmoSystem] Entity " << entityId << " gained " << amount 
-              << " ammo, total: " << ammo->currentAmmo << "/" << ammo->totalAmmo << std::endl;
+    LOG_DEBUG("AmmoSystem") << "Entity " << entityId << " gained " << amount 
+                           << " ammo, total: " << ammo->currentAmmo << "/" << ammo->totalAmmo;
 }
 
 int AmmoSystem::GetCurrentAmmo(uint32_t entityId) const {
@@ -129,9 +129,9 @@ void AmmoSystem::InitializeAmmoFromWeapon(uint32_t entityId) {
     ammo->totalAmmo = 120;
     ammo->maxTotalAmmo = 300;
     
-    std::cout << "[AmmoSystem] Entity " << entityId << " initialized with default ammo: " 
-              << ammo->currentAmmo << "/" << ammo->totalAmmo 
-              << " (max: " << ammo->maxTotalAmmo << ")" << std::endl;
+    LOG_INFO("AmmoSystem") << "Entity " << entityId << " initialized with default ammo: " 
+                           << ammo->currentAmmo << "/" << ammo->totalAmmo 
+                           << " (max: " << ammo->maxTotalAmmo << ")";
 }
 
 void AmmoSystem::SetAmmo(uint32_t entityId, int currentAmmo, int totalAmmo) {
@@ -144,10 +144,10 @@ void AmmoSystem::SetAmmo(uint32_t entityId, int currentAmmo, int totalAmmo) {
     int oldTotal = ammo->totalAmmo;
     
     // DEBUG: Show what SetAmmo is trying to set and current state
-    std::cout << "[AmmoSystem] SetAmmo called for entity " << entityId 
-              << " with values: currentAmmo=" << currentAmmo << ", totalAmmo=" << totalAmmo << std::endl;
-    std::cout << "[AmmoSystem] Entity " << entityId << " ammo BEFORE SetAmmo: " 
-              << oldCurrent << "/" << oldTotal << " (max: " << ammo->maxTotalAmmo << ")" << std::endl;
+    LOG_DEBUG("AmmoSystem") << "SetAmmo called for entity " << entityId 
+                           << " with values: currentAmmo=" << currentAmmo << ", totalAmmo=" << totalAmmo;
+    LOG_DEBUG("AmmoSystem") << "Entity " << entityId << " ammo BEFORE SetAmmo: " 
+                           << oldCurrent << "/" << oldTotal << " (max: " << ammo->maxTotalAmmo << ")";
     
     ammo->currentAmmo = std::max(0, currentAmmo);
     ammo->totalAmmo = std::max(0, totalAmmo);
@@ -158,8 +158,8 @@ void AmmoSystem::SetAmmo(uint32_t entityId, int currentAmmo, int totalAmmo) {
     
     PublishAmmoChangedEvent(entityId, oldCurrent, oldTotal, ammo->currentAmmo, ammo->totalAmmo);
     
-    std::cout << "[AmmoSystem] Entity " << entityId << " ammo set to: " 
-              << ammo->currentAmmo << "/" << ammo->totalAmmo << std::endl;
+    LOG_DEBUG("AmmoSystem") << "Entity " << entityId << " ammo set to: " 
+                           << ammo->currentAmmo << "/" << ammo->totalAmmo;
 }
 
 void AmmoSystem::SetMaxAmmo(uint32_t entityId, int maxAmmo) {
@@ -174,7 +174,7 @@ void AmmoSystem::SetMaxAmmo(uint32_t entityId, int maxAmmo) {
         ammo->totalAmmo = ammo->maxTotalAmmo;
     }
     
-    std::cout << "[AmmoSystem] Entity " << entityId << " max ammo set to: " << maxAmmo << std::endl;
+    LOG_DEBUG("AmmoSystem") << "Entity " << entityId << " max ammo set to: " << maxAmmo;
 }
 
 void AmmoSystem::HandleGameEvent(const std::shared_ptr<engine::event::Event>& event) {
@@ -215,15 +215,15 @@ void AmmoSystem::HandleAmmoConsumeRequest(const std::shared_ptr<void>& eventData
     // Debug: Show current ammo status before attempting to consume
     auto* ammo = GetAmmoComponent(data->playerId);
     if (ammo) {
-        std::cout << "[AmmoSystem] Player " << data->playerId << " ammo status BEFORE consumption: " 
-                  << ammo->currentAmmo << "/" << ammo->totalAmmo << " (max: " << ammo->maxTotalAmmo << ")" << std::endl;
+        LOG_DEBUG("AmmoSystem") << "Player " << data->playerId << " ammo status BEFORE consumption: " 
+                               << ammo->currentAmmo << "/" << ammo->totalAmmo << " (max: " << ammo->maxTotalAmmo << ")";
     } else {
-        std::cout << "[AmmoSystem] ERROR: Player " << data->playerId << " has NO AmmoComponent!" << std::endl;
+        LOG_ERROR("AmmoSystem") << "Player " << data->playerId << " has NO AmmoComponent!";
     }
     
     if (!CanConsume(data->playerId, data->amount)) {
-        std::cout << "[AmmoSystem] Player " << data->playerId << " cannot consume " 
-                  << data->amount << " ammo - insufficient ammo" << std::endl;
+        LOG_DEBUG("AmmoSystem") << "Player " << data->playerId << " cannot consume " 
+                               << data->amount << " ammo - insufficient ammo";
         return;
     }
     
@@ -232,8 +232,8 @@ void AmmoSystem::HandleAmmoConsumeRequest(const std::shared_ptr<void>& eventData
     // Publish WEAPON_FIRED event to notify WeaponSystem to apply cooldown
     PublishWeaponFiredEvent(data->playerId);
     
-    std::cout << "[AmmoSystem] Player " << data->playerId << " ammo consume request approved, " 
-              << data->amount << " ammo consumed" << std::endl;
+    LOG_DEBUG("AmmoSystem") << "Player " << data->playerId << " ammo consume request approved, " 
+                           << data->amount << " ammo consumed";
 }
 
 void AmmoSystem::HandleAmmoConsumed(const std::shared_ptr<void>& eventData) {
@@ -243,7 +243,7 @@ void AmmoSystem::HandleAmmoConsumed(const std::shared_ptr<void>& eventData) {
     // Handle ammo consumption statistics or other logic
     // Actual ammo quantity change has been handled in WeaponSystem
     
-    std::cout << "[AmmoSystem] Handled ammo consumed event for entity " << data->entityId << std::endl;
+    LOG_DEBUG("AmmoSystem") << "Handled ammo consumed event for entity " << data->entityId;
 }
 
 void AmmoSystem::HandleReloadCompleted(const std::shared_ptr<void>& eventData) {
@@ -275,7 +275,7 @@ void AmmoSystem::HandleReloadCompleted(const std::shared_ptr<void>& eventData) {
         it->second.isActive = false;
     }
     
-    std::cout << "[AmmoSystem] Reload completed for entity " << data->entityId << ", ammo replenished and state cleared" << std::endl;
+    LOG_DEBUG("AmmoSystem") << "Reload completed for entity " << data->entityId << ", ammo replenished and state cleared";
 }
 
 void AmmoSystem::HandleWeaponFireRequested(const std::shared_ptr<void>& eventData) {
@@ -283,26 +283,26 @@ void AmmoSystem::HandleWeaponFireRequested(const std::shared_ptr<void>& eventDat
     if (!data) return;
     
     if (!CanConsume(data->entityId, 1)) {
-        std::cout << "[AmmoSystem] Entity " << data->entityId << " cannot fire - no ammo" << std::endl;
+        LOG_DEBUG("AmmoSystem") << "Entity " << data->entityId << " cannot fire - no ammo";
         return;
     }
     
     ConsumeAmmo(data->entityId, 1);
     
-    std::cout << "[AmmoSystem] Entity " << data->entityId << " fire request approved and ammo consumed" << std::endl;
+    LOG_DEBUG("AmmoSystem") << "Entity " << data->entityId << " fire request approved and ammo consumed";
 }
 
 bool AmmoSystem::ValidateEntityId(uint32_t entityId, const std::string& operation) const {
     auto* world = GetWorld();
     if (!world) {
-        std::cerr << "[AmmoSystem] Error: No world available for " << operation << std::endl;
+        LOG_ERROR("AmmoSystem") << "No world available for " << operation;
         return false;
     }
     
     auto& componentManager = world->GetComponentManager();
     if (!componentManager.HasComponent<Component::AmmoComponent>(entityId)) {
-        std::cerr << "[AmmoSystem] Error: Entity " << entityId 
-                  << " does not have AmmoComponent for " << operation << std::endl;
+        LOG_ERROR("AmmoSystem") << "Entity " << entityId 
+                                << " does not have AmmoComponent for " << operation;
         return false;
     }
     
@@ -311,8 +311,8 @@ bool AmmoSystem::ValidateEntityId(uint32_t entityId, const std::string& operatio
 
 bool AmmoSystem::ValidateAmmoAmount(int amount, const std::string& operation) const {
     if (amount < 0) {
-        std::cerr << "[AmmoSystem] Error: Invalid ammo amount " << amount 
-                  << " for " << operation << " (must be >= 0)" << std::endl;
+        LOG_ERROR("AmmoSystem") << "Invalid ammo amount " << amount 
+                                << " for " << operation << " (must be >= 0)";
         return false;
     }
     return true;
@@ -399,7 +399,7 @@ void AmmoSystem::ExecuteReload(uint32_t entityId, int reloadAmount, int magazine
     int actualReload = std::min({reloadAmount, neededAmmo, availableAmmo});
     
     if (actualReload <= 0) {
-        std::cout << "[AmmoSystem] Entity " << entityId << " - no ammo to reload" << std::endl;
+        LOG_DEBUG("AmmoSystem") << "Entity " << entityId << " - no ammo to reload";
         PublishReloadExecutedEvent(entityId, 0, ammo->currentAmmo, ammo->totalAmmo);
         return;
     }
@@ -413,8 +413,8 @@ void AmmoSystem::ExecuteReload(uint32_t entityId, int reloadAmount, int magazine
     PublishAmmoChangedEvent(entityId, oldCurrent, oldTotal, ammo->currentAmmo, ammo->totalAmmo);
     PublishReloadExecutedEvent(entityId, actualReload, ammo->currentAmmo, ammo->totalAmmo);
     
-    std::cout << "[AmmoSystem] Entity " << entityId << " reloaded " << actualReload 
-              << " ammo, new state: " << ammo->currentAmmo << "/" << ammo->totalAmmo << std::endl;
+    LOG_DEBUG("AmmoSystem") << "Entity " << entityId << " reloaded " << actualReload 
+                           << " ammo, new state: " << ammo->currentAmmo << "/" << ammo->totalAmmo;
 }
 
 void AmmoSystem::HandleReloadExecute(const std::shared_ptr<void>& eventData) {
@@ -431,9 +431,9 @@ void AmmoSystem::HandleWeaponInitialized(const std::shared_ptr<void>& eventData)
     SetAmmo(data->entityId, data->magazineCapacity, data->defaultTotalAmmo);
     SetMaxAmmo(data->entityId, data->maxTotalAmmo);
     
-    std::cout << "[AmmoSystem] Entity " << data->entityId << " initialized with weapon config: " 
-              << data->magazineCapacity << "/" << data->defaultTotalAmmo 
-              << " (max: " << data->maxTotalAmmo << ")" << std::endl;
+    LOG_INFO("AmmoSystem") << "Entity " << data->entityId << " initialized with weapon config: " 
+                           << data->magazineCapacity << "/" << data->defaultTotalAmmo 
+                           << " (max: " << data->maxTotalAmmo << ")";
 }
 
 void AmmoSystem::HandleReloadStarted(const std::shared_ptr<void>& eventData) {
@@ -453,8 +453,8 @@ void AmmoSystem::HandleReloadStarted(const std::shared_ptr<void>& eventData) {
     reloadState.elapsedTime = 0.0f;
     reloadState.isActive = true;
     
-    std::cout << "[AmmoSystem] Entity " << data->entityId << " started reloading (time: " 
-              << data->reloadTime << "s), AmmoComponent state updated" << std::endl;
+    LOG_DEBUG("AmmoSystem") << "Entity " << data->entityId << " started reloading (time: " 
+                           << data->reloadTime << "s), AmmoComponent state updated";
 }
 
 void AmmoSystem::PublishReloadExecutedEvent(uint32_t entityId, int actualReload, int newCurrent, int newTotal) {
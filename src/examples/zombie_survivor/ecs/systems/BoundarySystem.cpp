@@ -2,12 +2,12 @@
 
 #include "BoundarySystem.hpp"
 #include "engine/core/ecs/World.hpp"
-#include <iostream>
+#include "engine/core/log/Logger.hpp"
 
 namespace ZombieSurvivor::System {
 
 void BoundarySystem::Init() {
-    std::cout << "[BoundarySystem] Initialized" << std::endl;
+    LOG_INFO("BoundarySystem") << "Initialized";
 }
 
 void BoundarySystem::Update(float deltaTime) {
@@ -17,20 +17,16 @@ void BoundarySystem::Update(float deltaTime) {
     auto& componentManager = world->GetComponentManager();
 
     // Get all entities that need boundary constraints
-    auto entities = componentManager.GetEntitiesWithComponents<
+    auto view = componentManager.GetView<
         engine::ECS::Transform2D,
         engine::ECS::Velocity2D,
         Component::BoundaryComponent
     >();
 
-    for (const auto& entityId : entities) {
-        auto* transform = componentManager.GetComponent<engine::ECS::Transform2D>(entityId);
-        auto* velocity = componentManager.GetComponent<engine::ECS::Velocity2D>(entityId);
-        auto* boundary = componentManager.GetComponent<Component::BoundaryComponent>(entityId);
+    for (auto [entityId, transform, velocity, boundary] : view) {
+        if (!boundary.enabled) continue;
 
-        if (!transform || !velocity || !boundary || !boundary->enabled) continue;
-
-        ApplyBoundaryConstraints(transform, velocity, boundary, deltaTime);
+        ApplyBoundaryConstraints(&transform, &velocity, &boundary, deltaTime);
     }
 }
 
@@ -12,7 +12,7 @@
 #include "examples/zombie_survivor/events/GameEventData.hpp"
 #include "examples/zombie_survivor/events/ProjectileEventUtils.hpp"
 #include "engine/core/ecs/systems/ParticleSystem.hpp"
-#include <iostream>
+#include "engine/core/log/Logger.hpp"
 
 namespace ZombieSurvivor::System {
 
@@ -25,7 +25,7 @@ void DamageSystem::Init() {
     eventManager.Subscribe(engine::event::EventType::COLLISION_STARTED, this);
     eventManager.Subscribe(engine::event::EventType::CUSTOM, this);
     
-    std::cout << "[DamageSystem] Subscribed to collision events" << std::endl;
+    LOG_INFO("DamageSystem") << "Subscribed to collision events";
 }
 
 void DamageSystem::Update(float deltaTime) {
@@ -43,7 +43,7 @@ void DamageSystem::Shutdown() {
     eventManager.Unsubscribe(engine::event::EventType::COLLISION_STARTED, this);
     eventManager.Unsubscribe(engine::event::EventType::CUSTOM, this);
     
-    std::cout << "[DamageSystem] Shutdown and unsubscribed from events" << std::endl;
+    LOG_INFO("DamageSystem") << "Shutdown and unsubscribed from events";
 }
 
 void DamageSystem::onEvent(const std::shared_ptr<engine::event::Event>& event) {
@@ -77,8 +77,8 @@ void DamageSystem::HandleCollisionEvent(const std::shared_ptr<engine::event::Eve
     engine::EntityID entityA = collisionData->entityA;
     engine::EntityID entityB = collisionData->entityB;
     
-    std::cout << "[DamageSystem] Collision event: A=" << entityA << " B=" << entityB 
-              << " LayerA=" << collisionData->layerA << " LayerB=" << collisionData->layerB << std::endl;
+    LOG_DEBUG("DamageSystem") << "Collision event: A=" << entityA << " B=" << entityB 
+                             << " LayerA=" << collisionData->layerA << " LayerB=" << collisionData->layerB;
     
     bool isProjectileA = componentManager.HasComponent<Component::ProjectileComponent>(entityA);
     bool isProjectileB = componentManager.HasComponent<Component::ProjectileComponent>(entityB);
@@ -87,8 +87,8 @@ void DamageSystem::HandleCollisionEvent(const std::shared_ptr<engine::event::Eve
     bool isPlayerA = IsPlayer(entityA);
     bool isPlayerB = IsPlayer(entityB);
     
-    std::cout << "[DamageSystem] Entity check - A=" << entityA << "(Enemy:" << isEnemyA << ", Player:" << isPlayerA << ") "
-              << "B=" << entityB << "(Enemy:" << isEnemyB << ", Player:" << isPlayerB << ")" << std::endl;
+    LOG_DEBUG("DamageSystem") << "Entity check - A=" << entityA << "(Enemy:" << isEnemyA << ", Player:" << isPlayerA << ") "
+                             << "B=" << entityB << "(Enemy:" << isEnemyB << ", Player:" << isPlayerB << ")";
     
     if (isProjectileA && isEnemyB) {
         HandleProjectileEnemyCollision(entityA, entityB);
@@ -97,8 +97,8 @@ void DamageSystem::HandleCollisionEvent(const std::shared_ptr<engine::event::Eve
     }
     
     if ((isEnemyA && isPlayerB) || (isEnemyB && isPlayerA)) {
-        std::cout << "[DamageSystem] Enemy-Player collision detected! EntityA=" << entityA 
-                  << " EntityB=" << entityB << std::endl;
+        LOG_DEBUG("DamageSystem") << "Enemy-Player collision detected! EntityA=" << entityA 
+                                 << " EntityB=" << entityB;
         HandleEnemyPlayerCollision(entityA, entityB);
     }
 }
@@ -133,9 +133,9 @@ void DamageSystem::DealDamage(uint32_t targetEntityId, uint32_t sourceEntityId,
     
     PublishDamageEvent(targetEntityId, sourceEntityId, damage, damageType);
     
-    std::cout << "[DamageSystem] Entity " << sourceEntityId 
-              << " dealt " << damage << " " << damageType 
-              << " damage to entity " << targetEntityId << std::endl;
+    LOG_DEBUG("DamageSystem") << "Entity " << sourceEntityId 
+                             << " dealt " << damage << " " << damageType 
+                             << " damage to entity " << targetEntityId;
 }
 
 int DamageSystem::CalculateDamage(uint32_t attackerId, uint32_t targetId, int baseDamage) {
@@ -221,8 +221,8 @@ void DamageSystem::HandleEnemyPlayerCollision(uint32_t entityA, uint32_t entityB
     DealDamage(playerEntity, enemyEntity, enemy->damage, "contact");
     enemy->lastDamageTime = currentTime;
     
-    std::cout << "[DamageSystem] Enemy " << enemyEntity 
-              << " dealt contact damage to player " << playerEntity << std::endl;
+    LOG_DEBUG("DamageSystem") << "Enemy " << enemyEntity 
+                             << " dealt contact damage to player " << playerEntity;
 }
 
 bool DamageSystem::IsPlayer(uint32_t entityId) {
@@ -250,13 +250,13 @@ void DamageSystem::HandleProjectileEnemyCollision(engine::ECS::EntityID projecti
     auto* projectile = componentManager.GetComponent<Component::ProjectileComponent>(projectileId);
     if (!projectile) return;
     
-    std::cout << "[DamageSystem] COLLISION EVENT: Projectile " << projectileId 
-              << " hit Enemy " << enemyId << " (hasHit=" << projectile->hasHit << ")" << std::endl;
+    LOG_DEBUG("DamageSystem") << "COLLISION EVENT: Projectile " << projectileId 
+                             << " hit Enemy " << enemyId << " (hasHit=" << projectile->hasHit << ")";
     
     // Prevent duplicate damage from same projectile
     if (projectile->hasHit) {
-        std::cout << "[DamageSystem] DUPLICATE HIT PREVENTED: Projectile " << projectileId 
-                  << " already hit a target, ignoring collision" << std::endl;
+        LOG_DEBUG("DamageSystem") << "DUPLICATE HIT PREVENTED: Projectile " << projectileId 
+                                 << " already hit a target, ignoring collision";
         return;
     }
     
@@ -280,7 +280,8 @@ void DamageSystem::HandleProjectileEnemyCollision(engine::ECS::EntityID projecti
                 {enemyTransform->x, enemyTransform->y},
                 15,  // particle count
                 {255, 50, 50, 255},  // red color
-                150.0f  // speed
+                150.0f,  // speed
+                &commandBuffer_
             );
         }
     }
@@ -295,7 +296,7 @@ void DamageSystem::HandleProjectileEnemyCollision(engine::ECS::EntityID projecti
         "enemy"
     );
     
-    std::cout << "[DamageSystem] Projectile hit enemy, damage: " << projectile->damage << std::endl;
+    LOG_DEBUG("DamageSystem") << "Projectile hit enemy, damage: " << projectile->damage;
 }
 
 } // namespace ZombieSurvivor::System 
\ No newline at end of file
@@ -3,7 +3,7 @@
 #include "examples/zombie_survivor/ecs/GameEntityFactory.hpp"
 #include "examples/zombie_survivor/ecs/components/EnemyComponent.hpp"
 #include "examples/zombie_survivor/ecs/components/HealthComponent.hpp"
-#include <iostream>
+#include "engine/core/log/Logger.hpp"
 
 namespace ZombieSurvivor::System {
 
@@ -12,9 +12,9 @@ using engine::ECS::EntityID;
 
 void EnemySpawnSystem::Init() {
     gen_ = std::mt19937(rd_());
-    std::cout << "[EnemySpawnSystem] Initialized with viewport: " 
-              << viewportWidth_ << "x" << viewportHeight_ 
-              << ", spawn margin: " << spawnMargin_ << std::endl;
+    LOG_INFO("EnemySpawnSystem") << "Initialized with viewport: " 
+                                 << viewportWidth_ << "x" << viewportHeight_ 
+                                 << ", spawn margin: " << spawnMargin_;
 }
 
 void EnemySpawnSystem::Update(float deltaTime) {
@@ -35,19 +35,19 @@ void EnemySpawnSystem::Update(float deltaTime) {
 }
 
 void EnemySpawnSystem::Shutdown() {
-    std::cout << "[EnemySpawnSystem] Shutdown. Total spawned: " << totalSpawned_ << std::endl;
+    LOG_INFO("EnemySpawnSystem") << "Shutdown. Total spawned: " << totalSpawned_;
 }
 
 void EnemySpawnSystem::SetViewportSize(float width, float height) {
     viewportWidth_ = width;
     viewportHeight_ = height;
-    std::cout << "[EnemySpawnSystem] Viewport size updated to: " 
-              << width << "x" << height << std::endl;
+    LOG_INFO("EnemySpawnSystem") << "Viewport size updated to: " 
+                                 << width << "x" << height;
 }
 
 void EnemySpawnSystem::SpawnZombie() {
     if (!gameEntityFactory_) {
-        std::cerr << "[EnemySpawnSystem] Error: GameEntityFactory not set!" << std::endl;
+        LOG_ERROR("EnemySpawnSystem") << "GameEntityFactory not set!";
         return;
     }
     
@@ -57,8 +57,8 @@ void EnemySpawnSystem::SpawnZombie() {
     if (zombie != 0) {
         totalSpawned_++;
         currentEnemyCount_++;
-        std::cout << "[EnemySpawnSystem] Spawned zombie #" << totalSpawned_ 
-                  << " at position (" << spawnPos.x << ", " << spawnPos.y << ")" << std::endl;
+        LOG_DEBUG("EnemySpawnSystem") << "Spawned zombie #" << totalSpawned_ 
+                                     << " at position (" << spawnPos.x << ", " << spawnPos.y << ")";
     }
 }
 
@@ -117,24 +117,24 @@ void EnemySpawnSystem::UpdateEnemyCount() {
 void EnemySpawnSystem::ClearAllEnemies() {
     auto* world = GetWorld();
     if (!world) {
-        std::cout << "[EnemySpawnSystem] Warning: No world available for cleanup" << std::endl;
+        LOG_WARN("EnemySpawnSystem") << "No world available for cleanup";
         return;
     }
     
     auto& componentManager = world->GetComponentManager();
-    auto& entityFactory = world->GetEntityFactory();
     auto enemies = componentManager.GetEntitiesWithComponent<Component::EnemyComponent>();
     
+    // Called from scene code between updates, so destroy immediately
     int clearedCount = 0;
     for (EntityID enemy : enemies) {
-        entityFactory.DestroyEntity(enemy);
+        world->DestroyEntity(enemy);
         clearedCount++;
     }
     
     currentEnemyCount_ = 0;
     totalSpawned_ = 0;
     
-    std::cout << "[EnemySpawnSystem] Cleared " << clearedCount << " enemies and reset counters" << std::endl;
+    LOG_INFO("EnemySpawnSystem") << "Cleared " << clearedCount << " enemies and reset counters";
 }
 
 } // namespace ZombieSurvivor::System
@@ -7,19 +7,20 @@
 #include "examples/zombie_survivor/events/GameEventTypes.hpp"
 #include "examples/zombie_survivor/events/GameEventData.hpp"
 #include "examples/zombie_survivor/events/GameEventUtils.hpp"
+#include "engine/core/log/Logger.hpp"
 
 namespace ZombieSurvivor::System {
 
 void ExperienceSystem::Init() {
-    std::cout << "[DEBUG] ExperienceSystem::Init() called" << std::endl;
+    LOG_DEBUG("ExperienceSystem") << "ExperienceSystem::Init() called";
     if (auto* world = GetWorld()) {
-        std::cout << "[DEBUG] World found: " << world << std::endl;
+        LOG_DEBUG("ExperienceSystem") << "World found: " << world;
         auto& eventManager = world->GetEventManager();
-        std::cout << "[DEBUG] EventManager: " << &eventManager << std::endl;
+        LOG_DEBUG("ExperienceSystem") << "EventManager: " << &eventManager;
         eventManager.Subscribe(engine::event::EventType::CUSTOM, this);
-        std::cout << "[DEBUG] ExperienceSystem subscribed to CUSTOM events" << std::endl;
+        LOG_DEBUG("ExperienceSystem") << "ExperienceSystem subscribed to CUSTOM events";
     } else {
-        std::cout << "[DEBUG] ERROR: No world found in ExperienceSystem::Init()" << std::endl;
+        LOG_ERROR("ExperienceSystem") << "No world found in ExperienceSystem::Init()";
     }
 }
 
@@ -39,14 +40,14 @@ void ExperienceSystem::Update(float deltaTime) {
 }
 
 void ExperienceSystem::onEvent(const std::shared_ptr<engine::event::Event>& event) {
-    std::cout << "  [DEBUG] ExperienceSystem received event, type: " << static_cast<int>(event->GetType()) << std::endl;
-    std::cout << "  [DEBUG] Expected CUSTOM type: " << static_cast<int>(engine::event::EventType::CUSTOM) << std::endl;
+    LOG_DEBUG("ExperienceSystem") << "ExperienceSystem received event, type: " << static_cast<int>(event->GetType());
+    LOG_DEBUG("ExperienceSystem") << "Expected CUSTOM type: " << static_cast<int>(engine::event::EventType::CUSTOM);
     
     if (event->GetType() == engine::event::EventType::CUSTOM) {
-        std::cout << "  [DEBUG] Processing CUSTOM event" << std::endl;
+        LOG_DEBUG("ExperienceSystem") << "Processing CUSTOM event";
         HandleGameEvent(event);
     } else {
-        std::cout << "  [DEBUG] Event type mismatch!" << std::endl;
+        LOG_DEBUG("ExperienceSystem") << "Event type mismatch!";
     }
 }
 
@@ -54,35 +55,35 @@ void ExperienceSystem::onEvent(const std::shared_ptr<engine::event::Event>& even
 void ExperienceSystem::HandleGameEvent(const std::shared_ptr<engine::event::Event>& event) {
     auto gameEvent = std::dynamic_pointer_cast<Events::GameEvent>(event);
     if (!gameEvent) {
-        std::cout << "  [DEBUG] Failed to cast to GameEvent" << std::endl;
+        LOG_DEBUG("ExperienceSystem") << "Failed to cast to GameEvent";
         return;
     }
 
     auto eventType = gameEvent->GetGameEventType();
-    std::cout << "  [DEBUG] GameEvent type: " << static_cast<int>(eventType) << std::endl;
+    LOG_DEBUG("ExperienceSystem") << "GameEvent type: " << static_cast<int>(eventType);
 
     switch (eventType) {
         case Events::GameEventType::ENEMY_KILLED:
-            std::cout << "  [DEBUG] Handling ENEMY_KILLED event" << std::endl;
+            LOG_DEBUG("ExperienceSystem") << "Handling ENEMY_KILLED event";
             HandleEnemyKilled(gameEvent->GetData());
             break;
         case Events::GameEventType::EXPERIENCE_GAINED:
-            std::cout << "  [DEBUG] Handling EXPERIENCE_GAINED event" << std::endl;
+            LOG_DEBUG("ExperienceSystem") << "Handling EXPERIENCE_GAINED event";
             HandleExperienceGained(gameEvent->GetData());
             break;
         default:
-            std::cout << "  [DEBUG] Unhandled event type: " << static_cast<int>(eventType) << std::endl;
+            LOG_DEBUG("ExperienceSystem") << "Unhandled event type: " << static_cast<int>(eventType);
             break;
     }
 }
 
 void ExperienceSystem::HandleEnemyKilled(const std::shared_ptr<void>& eventData) {
     if (auto data = std::static_pointer_cast<Events::EnemyKilledData>(eventData)) {
-        std::cout << "  [DEBUG] Enemy killed - Player: " << data->playerId 
-                  << ", ExpReward: " << data->expReward << std::endl;
+        LOG_DEBUG("ExperienceSystem") << "Enemy killed - Player: " << data->playerId 
+                                      << ", ExpReward: " << data->expReward;
         AddExperience(data->playerId, data->expReward);
     } else {
-        std::cout << "  [DEBUG] Failed to cast EnemyKilledData" << std::endl;
+        LOG_DEBUG("ExperienceSystem") << "Failed to cast EnemyKilledData";
     }
 }
 
@@ -94,11 +95,11 @@ void ExperienceSystem::HandleExperienceGained(const std::shared_ptr<void>& event
 }
 
 void ExperienceSystem::AddExperience(uint32_t entityId, int experience) {
-    std::cout << "  [DEBUG] Adding " << experience << " experience to entity " << entityId << std::endl;
+    LOG_DEBUG("ExperienceSystem") << "Adding " << experience << " experience to entity " << entityId;
     
     auto* world = GetWorld();
     if (!world) {
-        std::cout << "  [DEBUG] No world available" << std::endl;
+        LOG_DEBUG("ExperienceSystem") << "No world available";
         return;
     }
 
@@ -106,21 +107,21 @@ void ExperienceSystem::AddExperience(uint32_t entityId, int experience) {
     auto* exp = componentManager.GetComponent<ZombieSurvivor::Component::ExperienceComponent>(entityId);
 
     if (!exp) {
-        std::cout << "  [DEBUG] No ExperienceComponent found for entity " << entityId << std::endl;
+        LOG_DEBUG("ExperienceSystem") << "No ExperienceComponent found for entity " << entityId;
         return;
     }
 
-    std::cout << "  [DEBUG] Before: Level=" << exp->level 
-              << ", Exp=" << exp->experience 
-              << ", ToNext=" << exp->experienceToNext << std::endl;
+    LOG_DEBUG("ExperienceSystem") << "Before: Level=" << exp->level 
+                                  << ", Exp=" << exp->experience 
+                                  << ", ToNext=" << exp->experienceToNext;
 
     exp->experience += experience;
 
-    std::cout << "  [DEBUG] After: Exp=" << exp->experience << std::endl;
+    LOG_DEBUG("ExperienceSystem") << "After: Exp=" << exp->experience;
 
     if (exp->experience >= exp->experienceToNext) {
         exp->canLevelUp = true;
-        std::cout << "  [DEBUG] Can level up!" << std::endl;
+        LOG_DEBUG("ExperienceSystem") << "Can level up!";
     }
 }
 
@@ -1,7 +1,7 @@
 // src/examples/zombie_survivor_Ecs/systems/GroundRenderSystem.cpp
 #include "GroundRenderSystem.hpp"
 #include "engine/core/ecs/World.hpp"
-#include <iostream>
+#include "engine/core/log/Logger.hpp"
 #include <vector>
 
 namespace ZombieSurvivor::System {
@@ -9,7 +9,7 @@ namespace ZombieSurvivor::System {
 void GroundRenderSystem::Init() {
     CreateGroundBackground();
     AddGroundDecorations();
-    std::cout << "[GroundRenderSystem] Initialized with background and decorations" << std::endl;
+    LOG_INFO("GroundRenderSystem") << "Initialized with background and decorations";
 }
 
 void GroundRenderSystem::Update(float deltaTime) {
@@ -17,7 +17,7 @@ void GroundRenderSystem::Update(float deltaTime) {
 }
 
 void GroundRenderSystem::Shutdown() {
-    std::cout << "[GroundRenderSystem] Shutdown" << std::endl;
+    LOG_INFO("GroundRenderSystem") << "Shutdown";
 }
 
 void GroundRenderSystem::CreateGroundBackground() {
@@ -48,7 +48,7 @@ void GroundRenderSystem::CreateGroundBackground() {
             {0.0f, 0.0f} 
         });
 
-    std::cout << "[GroundRenderSystem] Created ground background entity: " << groundEntityId_ << std::endl;
+    LOG_INFO("GroundRenderSystem") << "Created ground background entity: " << groundEntityId_;
 }
 
 void GroundRenderSystem::AddGroundDecorations() {
@@ -88,7 +88,7 @@ void GroundRenderSystem::AddGroundDecorations() {
     
     decorationEntities_.push_back(grassEntity);
     
-    std::cout << "[GroundRenderSystem] Added " << decorationEntities_.size() << " decoration entities" << std::endl;
+    LOG_INFO("GroundRenderSystem") << "Added " << decorationEntities_.size() << " decoration entities";
 }
 
 }
@@ -9,7 +9,7 @@
 #include "examples/zombie_survivor/ecs/components/PlayerStatsComponent.hpp"
 #include "examples/zombie_survivor/events/GameEventData.hpp"
 #include "examples/zombie_survivor/events/GameEventTypes.hpp"
-#include <iostream>
+#include "engine/core/log/Logger.hpp"
 #include <chrono>
 #include <sstream>
 #include <iomanip>
@@ -28,7 +28,7 @@ void HUDDataSystem::Init() {
     
     gameStartTime_ = GetCurrentTime();
     
-    std::cout << "[HUDDataSystem] Initialized with UIFactory and subscribed to game events" << std::endl;
+    LOG_INFO("HUDDataSystem") << "Initialized with UIFactory and subscribed to game events";
 }
 
 void HUDDataSystem::Update(float deltaTime) {
@@ -80,7 +80,7 @@ void HUDDataSystem::Shutdown() {
     auto& eventManager = world->GetEventManager();
     eventManager.Unsubscribe(engine::event::EventType::CUSTOM, this);
     
-    std::cout << "[HUDDataSystem] Shutdown and unsubscribed from events" << std::endl;
+    LOG_INFO("HUDDataSystem") << "Shutdown and unsubscribed from events";
 }
 
 void HUDDataSystem::onEvent(const std::shared_ptr<engine::event::Event>& event) {
@@ -97,7 +97,7 @@ void HUDDataSystem::onEvent(const std::shared_ptr<engine::event::Event>& event)
 
 uint32_t HUDDataSystem::CreateHealthHUD(uint32_t targetPlayerId, Component::HUDPosition position) {
     if (!uiFactory_) {
-        std::cerr << "[HUDDataSystem] Error: UIFactory not initialized" << std::endl;
+        LOG_ERROR("HUDDataSystem") << "UIFactory not initialized";
         return 0;
     }
     
@@ -106,7 +106,7 @@ uint32_t HUDDataSystem::CreateHealthHUD(uint32_t targetPlayerId, Component::HUDP
 
 uint32_t HUDDataSystem::CreateAmmoHUD(uint32_t targetPlayerId, Component::HUDPosition position) {
     if (!uiFactory_) {
-        std::cerr << "[HUDDataSystem] Error: UIFactory not initialized" << std::endl;
+        LOG_ERROR("HUDDataSystem") << "UIFactory not initialized";
         return 0;
     }
     
@@ -115,7 +115,7 @@ uint32_t HUDDataSystem::CreateAmmoHUD(uint32_t targetPlayerId, Component::HUDPos
 
 uint32_t HUDDataSystem::CreateExperienceHUD(uint32_t targetPlayerId, Component::HUDPosition position) {
     if (!uiFactory_) {
-        std::cerr << "[HUDDataSystem] Error: UIFactory not initialized" << std::endl;
+        LOG_ERROR("HUDDataSystem") << "UIFactory not initialized";
         return 0;
     }
     
@@ -124,7 +124,7 @@ uint32_t HUDDataSystem::CreateExperienceHUD(uint32_t targetPlayerId, Component::
 
 uint32_t HUDDataSystem::CreateKillCounterHUD(uint32_t targetPlayerId, Component::HUDPosition position) {
     if (!uiFactory_) {
-        std::cerr << "[HUDDataSystem] Error: UIFactory not initialized" << std::endl;
+        LOG_ERROR("HUDDataSystem") << "UIFactory not initialized";
         return 0;
     }
     
@@ -133,7 +133,7 @@ uint32_t HUDDataSystem::CreateKillCounterHUD(uint32_t targetPlayerId, Component:
 
 uint32_t HUDDataSystem::CreateSurvivalTimerHUD(Component::HUDPosition position) {
     if (!uiFactory_) {
-        std::cerr << "[HUDDataSystem] Error: UIFactory not initialized" << std::endl;
+        LOG_ERROR("HUDDataSystem") << "UIFactory not initialized";
         return 0;
     }
     
@@ -142,7 +142,7 @@ uint32_t HUDDataSystem::CreateSurvivalTimerHUD(Component::HUDPosition position)
 
 uint32_t HUDDataSystem::CreateCrosshairHUD(Component::HUDPosition position) {
     if (!uiFactory_) {
-        std::cerr << "[HUDDataSystem] Error: UIFactory not initialized" << std::endl;
+        LOG_ERROR("HUDDataSystem") << "UIFactory not initialized";
         return 0;
     }
     
@@ -288,22 +288,22 @@ void HUDDataSystem::HandleGameEvent(const std::shared_ptr<engine::event::Event>&
 
 void HUDDataSystem::OnHealthChanged(uint32_t playerId) {
     // Refresh health HUD immediately when health changes
-    std::cout << "[HUDDataSystem] Health changed for player " << playerId << std::endl;
+    LOG_DEBUG("HUDDataSystem") << "Health changed for player " << playerId;
 }
 
 void HUDDataSystem::OnAmmoChanged(uint32_t playerId) {
     // Refresh ammo HUD immediately when ammo changes
-    std::cout << "[HUDDataSystem] Ammo changed for player " << playerId << std::endl;
+    LOG_DEBUG("HUDDataSystem") << "Ammo changed for player " << playerId;
 }
 
 void HUDDataSystem::OnExperienceChanged(uint32_t playerId) {
     // Refresh experience HUD immediately when experience changes
-    std::cout << "[HUDDataSystem] Experience changed for player " << playerId << std::endl;
+    LOG_DEBUG("HUDDataSystem") << "Experience changed for player " << playerId;
 }
 
 void HUDDataSystem::OnEnemyKilled(uint32_t playerId) {
     // Refresh kill counter HUD when enemy is killed
-    std::cout << "[HUDDataSystem] Enemy killed by player " << playerId << std::endl;
+    LOG_DEBUG("HUDDataSystem") << "Enemy killed by player " << playerId;
 }
 
 std::string HUDDataSystem::FormatTime(float timeInSeconds) const {
@@ -322,7 +322,7 @@ std::string HUDDataSystem::FormatAmmoText(int current, int max) const {
 
 bool HUDDataSystem::ValidatePlayerId(uint32_t playerId, const std::string& operation) const {
     if (playerId == 0) {
-        std::cout << "[HUDDataSystem] Invalid player ID in " << operation << std::endl;
+        LOG_INFO("HUDDataSystem") << "Invalid player ID in " << operation;
         return false;
     }
     return true;
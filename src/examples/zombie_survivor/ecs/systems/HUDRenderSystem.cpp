@@ -5,14 +5,28 @@
 #include "engine/core/ecs/components/Tag.hpp"
 #include "examples/zombie_survivor/ecs/components/WeaponComponent.hpp"
 #include "examples/zombie_survivor/ecs/components/AmmoComponent.hpp"
-#include <iostream>
+#include "engine/core/log/Logger.hpp"
 #include <algorithm>
 
 namespace ZombieSurvivor::System {
 
 void HUDRenderSystem::Init() {
+    auto* world = GetWorld();
+    if (world) {
+        // New/removed HUD elements are queued here instead of rescanning every frame
+        auto& componentManager = world->GetComponentManager();
+        hudAddedObserver_ = componentManager.OnAdd<Component::HUDComponent>(
+            [this](engine::EntityID id, Component::HUDComponent&) {
+                pendingHudEntities_.push_back(id);
+            });
+        hudRemovedObserver_ = componentManager.OnRemove<Component::HUDComponent>(
+            [this](engine::EntityID id, Component::HUDComponent&) {
+                removedHudEntities_.push_back(id);
+            });
+    }
+
     CreateHUDVisuals();
-    std::cout << "[HUDRenderSystem] Initialized with visual entity creation" << std::endl;
+    LOG_INFO("HUDRenderSystem") << "Initialized with visual entity creation";
 }
 
 void HUDRenderSystem::Update(float deltaTime) {
@@ -20,14 +34,25 @@ void HUDRenderSystem::Update(float deltaTime) {
 }
 
 void HUDRenderSystem::Shutdown() {
-    for (uint32_t visualEntityId : visualEntities_) {
-        CleanupVisualEntity(visualEntityId);
+    if (auto* world = GetWorld()) {
+        auto& componentManager = world->GetComponentManager();
+        componentManager.RemoveObserver(hudAddedObserver_);
+        componentManager.RemoveObserver(hudRemovedObserver_);
+    }
+    pendingHudEntities_.clear();
+    removedHudEntities_.clear();
+
+    // No flush follows Shutdown, so destroy the visuals immediately
+    if (auto* world = GetWorld()) {
+        for (uint32_t visualEntityId : visualEntities_) {
+            world->DestroyEntity(visualEntityId);
+        }
     }
     visualEntities_.clear();
     hudToVisualMap_.clear();
     hudToForegroundMap_.clear();
     
-    std::cout << "[HUDRenderSystem] Shutdown and cleaned up visual entities" << std::endl;
+    LOG_INFO("HUDRenderSystem") << "Shutdown and cleaned up visual entities";
 }
 
 void HUDRenderSystem::CreateHUDVisuals() {
@@ -38,47 +63,51 @@ void HUDRenderSystem::CreateHUDVisuals() {
     auto hudEntities = componentManager.GetEntitiesWithComponent<Component::HUDComponent>();
     
     for (uint32_t hudEntityId : hudEntities) {
-        auto* hud = componentManager.GetComponent<Component::HUDComponent>(hudEntityId);
-        if (!hud || !hud->visible) continue;
-        
-        // Skip if visual already exists
-        if (hudToVisualMap_.find(hudEntityId) != hudToVisualMap_.end()) continue;
-        
-        uint32_t visualEntityId = 0;
-        
-        switch (hud->type) {
-            case Component::HUDElementType::HEALTH_BAR:
-                visualEntityId = CreateHealthBarVisual(hud);
-                break;
-            case Component::HUDElementType::AMMO_COUNTER:
-                visualEntityId = CreateAmmoCounterVisual(hud);
-                break;
-            case Component::HUDElementType::EXPERIENCE_BAR:
-                visualEntityId = CreateExperienceBarVisual(hud);
-                break;
-            case Component::HUDElementType::KILL_COUNTER:
-                visualEntityId = CreateKillCounterVisual(hud);
-                break;
-            case Component::HUDElementType::SURVIVAL_TIME:
-                visualEntityId = CreateSurvivalTimerVisual(hud);
-                break;
-            case Component::HUDElementType::CROSSHAIR:
-                visualEntityId = CreateCrosshairVisual(hud);
-                break;
-            default:
-                break;
-        }
+        CreateHUDVisual(hudEntityId);
+    }
+}
+
+void HUDRenderSystem::CreateHUDVisual(uint32_t hudEntityId) {
+    auto* hud = GetHUDComponent(hudEntityId);
+    if (!hud || !hud->visible) return;
+    
+    // Skip if visual already exists
+    if (hudToVisualMap_.find(hudEntityId) != hudToVisualMap_.end()) return;
+    
+    uint32_t visualEntityId = 0;
+    
+    switch (hud->type) {
+        case Component::HUDElementType::HEALTH_BAR:
+            visualEntityId = CreateHealthBarVisual(hud);
+            break;
+        case Component::HUDElementType::AMMO_COUNTER:
+            visualEntityId = CreateAmmoCounterVisual(hud);
+            break;
+        case Component::HUDElementType::EXPERIENCE_BAR:
+            visualEntityId = CreateExperienceBarVisual(hud);
+            break;
+        case Component::HUDElementType::KILL_COUNTER:
+            visualEntityId = CreateKillCounterVisual(hud);
+            break;
+        case Component::HUDElementType::SURVIVAL_TIME:
+            visualEntityId = CreateSurvivalTimerVisual(hud);
+            break;
+        case Component::HUDElementType::CROSSHAIR:
+            visualEntityId = CreateCrosshairVisual(hud);
+            break;
+        default:
+            break;
+    }
+    
+    if (visualEntityId != 0) {
+        hudToVisualMap_[hudEntityId] = visualEntityId;
+        visualEntities_.push_back(visualEntityId);
         
-        if (visualEntityId != 0) {
-            hudToVisualMap_[hudEntityId] = visualEntityId;
-            visualEntities_.push_back(visualEntityId);
-            
-            // For health bars, also track the foreground entity
-            if (hud->type == Component::HUDElementType::HEALTH_BAR) {
-                if (lastCreatedForegroundEntity_ != 0) {
-                    hudToForegroundMap_[hudEntityId] = lastCreatedForegroundEntity_;
-                    lastCreatedForegroundEntity_ = 0; // Reset for next use
-                }
+        // For health bars, also track the foreground entity
+        if (hud->type == Component::HUDElementType::HEALTH_BAR) {
+            if (lastCreatedForegroundEntity_ != 0) {
+                hudToForegroundMap_[hudEntityId] = lastCreatedForegroundEntity_;
+                lastCreatedForegroundEntity_ = 0; // Reset for next use
             }
         }
     }
@@ -92,6 +121,7 @@ void HUDRenderSystem::UpdateHUDVisuals() {
     
     // Update existing visuals (collect invalid entities first to avoid iterator invalidation)
     std::vector<uint32_t> invalidHudEntities;
+    invalidHudEntities.swap(removedHudEntities_);
     
     for (auto& [hudEntityId, visualEntityId] : hudToVisualMap_) {
         if (!IsHUDEntityValid(hudEntityId)) {
@@ -138,8 +168,18 @@ void HUDRenderSystem::UpdateHUDVisuals() {
         }
     }
     
-    // Check for new HUD entities
-    CreateHUDVisuals();
+    // Build visuals for HUD entities added since last frame; hidden ones wait
+    // until they become visible
+    std::vector<uint32_t> pending;
+    pending.swap(pendingHudEntities_);
+    for (uint32_t hudEntityId : pending) {
+        auto* hud = GetHUDComponent(hudEntityId);
+        if (hud && !hud->visible) {
+            pendingHudEntities_.push_back(hudEntityId);
+            continue;
+        }
+        CreateHUDVisual(hudEntityId);
+    }
 }
 
 void HUDRenderSystem::SetScreenSize(int width, int height) {
@@ -176,22 +216,22 @@ uint32_t HUDRenderSystem::CreateHealthBarVisual(const Component::HUDComponent* h
     
     uint32_t visualEntityId = entityFactory.CreateEntity(GenerateVisualName(hud->type));
     
-    std::cout << "[HUDRenderSystem] Creating health bar with bounds: (" 
-              << hud->bounds.x << "," << hud->bounds.y << "," << hud->bounds.w << "," << hud->bounds.h << ")" << std::endl;
-    std::cout << "[HUDRenderSystem] HUD position type: " << static_cast<int>(hud->position) << std::endl;
+    LOG_INFO("HUDRenderSystem") << "Creating health bar with bounds: (" 
+                                << hud->bounds.x << "," << hud->bounds.y << "," << hud->bounds.w << "," << hud->bounds.h << ")";
+    LOG_INFO("HUDRenderSystem") << "HUD position type: " << static_cast<int>(hud->position);
     
     SDL_Rect screenPos;
     
     if (hud->position == Component::HUDPosition::CUSTOM) {
         screenPos = CalculateCustomPosition(hud->bounds);
-        std::cout << "[HUDRenderSystem] Using CUSTOM position from bounds" << std::endl;
+        LOG_INFO("HUDRenderSystem") << "Using CUSTOM position from bounds";
     } else {
         screenPos = CalculateScreenPosition(hud->position, hud->bounds.w, hud->bounds.h);
-        std::cout << "[HUDRenderSystem] Using calculated position for preset position" << std::endl;
+        LOG_INFO("HUDRenderSystem") << "Using calculated position for preset position";
     }
     
-    std::cout << "[HUDRenderSystem] Final screen position: (" 
-              << screenPos.x << "," << screenPos.y << "," << screenPos.w << "," << screenPos.h << ")" << std::endl;
+    LOG_INFO("HUDRenderSystem") << "Final screen position: (" 
+                                << screenPos.x << "," << screenPos.y << "," << screenPos.w << "," << screenPos.h << ")";
     
     componentManager.AddComponent<engine::ECS::Transform2D>(visualEntityId,
         engine::ECS::Transform2D{
@@ -218,7 +258,7 @@ uint32_t HUDRenderSystem::CreateHealthBarVisual(const Component::HUDComponent* h
             ZombieSurvivor::ECS::ToInt(ZombieSurvivor::ECS::RenderLayer::UI)
         });
     
-    std::cout << "[HUDRenderSystem] Created health bar visual entity (simple style like ammo bars)" << std::endl;
+    LOG_INFO("HUDRenderSystem") << "Created health bar visual entity (simple style like ammo bars)";
     
     return visualEntityId;
 }
@@ -232,22 +272,22 @@ uint32_t HUDRenderSystem::CreateAmmoCounterVisual(const Component::HUDComponent*
     
     uint32_t visualEntityId = entityFactory.CreateEntity(GenerateVisualName(hud->type));
     
-    std::cout << "[HUDRenderSystem] Creating ammo counter with bounds: (" 
-              << hud->bounds.x << "," << hud->bounds.y << "," << hud->bounds.w << "," << hud->bounds.h << ")" << std::endl;
-    std::cout << "[HUDRenderSystem] Ammo counter position type: " << static_cast<int>(hud->position) << std::endl;
+    LOG_INFO("HUDRenderSystem") << "Creating ammo counter with bounds: (" 
+                                << hud->bounds.x << "," << hud->bounds.y << "," << hud->bounds.w << "," << hud->bounds.h << ")";
+    LOG_INFO("HUDRenderSystem") << "Ammo counter position type: " << static_cast<int>(hud->position);
     
     SDL_Rect screenPos;
     
     if (hud->position == Component::HUDPosition::CUSTOM) {
         screenPos = CalculateCustomPosition(hud->bounds);
-        std::cout << "[HUDRenderSystem] Ammo counter using CUSTOM position from bounds" << std::endl;
+        LOG_INFO("HUDRenderSystem") << "Ammo counter using CUSTOM position from bounds";
     } else {
         screenPos = CalculateScreenPosition(hud->position, hud->bounds.w, hud->bounds.h);
-        std::cout << "[HUDRenderSystem] Ammo counter using calculated position for preset position" << std::endl;
+        LOG_INFO("HUDRenderSystem") << "Ammo counter using calculated position for preset position";
     }
     
-    std::cout << "[HUDRenderSystem] Ammo counter final screen position: (" 
-              << screenPos.x << "," << screenPos.y << "," << screenPos.w << "," << screenPos.h << ")" << std::endl;
+    LOG_INFO("HUDRenderSystem") << "Ammo counter final screen position: (" 
+                                << screenPos.x << "," << screenPos.y << "," << screenPos.w << "," << screenPos.h << ")";
     
     componentManager.AddComponent<engine::ECS::Transform2D>(visualEntityId,
         engine::ECS::Transform2D{
@@ -373,9 +413,9 @@ uint32_t HUDRenderSystem::CreateAmmoCounterVisual(const Component::HUDComponent*
     visualEntities_.push_back(reserveEntityId);
     visualEntities_.push_back(reloadEntityId);
     
-    std::cout << "[HUDRenderSystem] Created ammo counter with magazine bar (entity " << visualEntityId 
-              << "), reserve bar (entity " << reserveEntityId << "), and reload bar (entity " 
-              << reloadEntityId << ")" << std::endl;
+    LOG_INFO("HUDRenderSystem") << "Created ammo counter with magazine bar (entity " << visualEntityId 
+                                << "), reserve bar (entity " << reserveEntityId << "), and reload bar (entity " 
+                                << reloadEntityId << ")";
     return visualEntityId;
 }
 
@@ -388,21 +428,21 @@ uint32_t HUDRenderSystem::CreateExperienceBarVisual(const Component::HUDComponen
     
     uint32_t visualEntityId = entityFactory.CreateEntity(GenerateVisualName(hud->type));
     
-    std::cout << "[HUDRenderSystem] Creating experience bar with bounds: (" 
-              << hud->bounds.x << "," << hud->bounds.y << "," << hud->bounds.w << "," << hud->bounds.h << ")" << std::endl;
+    LOG_INFO("HUDRenderSystem") << "Creating experience bar with bounds: (" 
+                                << hud->bounds.x << "," << hud->bounds.y << "," << hud->bounds.w << "," << hud->bounds.h << ")";
     
     SDL_Rect screenPos;
     
     if (hud->position == Component::HUDPosition::CUSTOM) {
         screenPos = CalculateCustomPosition(hud->bounds);
-        std::cout << "[HUDRenderSystem] Experience bar using CUSTOM position from bounds" << std::endl;
+        LOG_INFO("HUDRenderSystem") << "Experience bar using CUSTOM position from bounds";
     } else {
         screenPos = CalculateScreenPosition(hud->position, hud->bounds.w, hud->bounds.h);
-        std::cout << "[HUDRenderSystem] Experience bar using calculated position for preset position" << std::endl;
+        LOG_INFO("HUDRenderSystem") << "Experience bar using calculated position for preset position";
     }
     
-    std::cout << "[HUDRenderSystem] Experience bar final screen position: (" 
-              << screenPos.x << "," << screenPos.y << "," << screenPos.w << "," << screenPos.h << ")" << std::endl;
+    LOG_INFO("HUDRenderSystem") << "Experience bar final screen position: (" 
+                                << screenPos.x << "," << screenPos.y << "," << screenPos.w << "," << screenPos.h << ")";
     
     componentManager.AddComponent<engine::ECS::Transform2D>(visualEntityId,
         engine::ECS::Transform2D{
@@ -431,7 +471,7 @@ uint32_t HUDRenderSystem::CreateExperienceBarVisual(const Component::HUDComponen
             ZombieSurvivor::ECS::ToInt(ZombieSurvivor::ECS::RenderLayer::UI)
         });
     
-    std::cout << "[HUDRenderSystem] Created experience bar visual entity (simple style like ammo bars)" << std::endl;
+    LOG_INFO("HUDRenderSystem") << "Created experience bar visual entity (simple style like ammo bars)";
     return visualEntityId;
 }
 
@@ -464,7 +504,7 @@ uint32_t HUDRenderSystem::CreateKillCounterVisual(const Component::HUDComponent*
             ZombieSurvivor::ECS::ToInt(ZombieSurvivor::ECS::RenderLayer::UI)
         });
     
-    std::cout << "[HUDRenderSystem] Created kill counter visual entity" << std::endl;
+    LOG_INFO("HUDRenderSystem") << "Created kill counter visual entity";
     return visualEntityId;
 }
 
@@ -497,7 +537,7 @@ uint32_t HUDRenderSystem::CreateSurvivalTimerVisual(const Component::HUDComponen
             ZombieSurvivor::ECS::ToInt(ZombieSurvivor::ECS::RenderLayer::UI)
         });
     
-    std::cout << "[HUDRenderSystem] Created survival timer visual entity" << std::endl;
+    LOG_INFO("HUDRenderSystem") << "Created survival timer visual entity";
     return visualEntityId;
 }
 
@@ -536,7 +576,7 @@ uint32_t HUDRenderSystem::CreateCrosshairVisual(const Component::HUDComponent* h
             ZombieSurvivor::ECS::ToInt(ZombieSurvivor::ECS::RenderLayer::UI)
         });
     
-    std::cout << "[HUDRenderSystem] Created crosshair visual entity" << std::endl;
+    LOG_INFO("HUDRenderSystem") << "Created crosshair visual entity";
     return visualEntityId;
 }
 
@@ -807,11 +847,8 @@ std::string HUDRenderSystem::GenerateVisualName(Component::HUDElementType type,
 }
 
 void HUDRenderSystem::CleanupVisualEntity(uint32_t visualEntityId) {
-    auto* world = GetWorld();
-    if (!world) return;
-    
-    auto& entityFactory = world->GetEntityFactory();
-    entityFactory.DestroyEntity(visualEntityId);
+    // Components and the ID go at this system's next sync point
+    commandBuffer_.DestroyEntity(visualEntityId);
     
     auto it = std::find(visualEntities_.begin(), visualEntities_.end(), visualEntityId);
     if (it != visualEntities_.end()) {
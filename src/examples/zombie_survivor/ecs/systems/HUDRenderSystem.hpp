@@ -39,6 +39,14 @@ private:
     std::vector<uint32_t> visualEntities_;
     uint32_t lastCreatedForegroundEntity_ = 0; // Temporary storage for foreground entity mapping
     
+    // Filled by HUDComponent observers, drained in UpdateHUDVisuals()
+    std::vector<uint32_t> pendingHudEntities_;
+    std::vector<uint32_t> removedHudEntities_;
+    engine::ECS::ComponentManager::ObserverHandle hudAddedObserver_;
+    engine::ECS::ComponentManager::ObserverHandle hudRemovedObserver_;
+    
+    void CreateHUDVisual(uint32_t hudEntityId);
+    
     // Visual creation methods
     uint32_t CreateHealthBarVisual(const Component::HUDComponent* hud);
     uint32_t CreateAmmoCounterVisual(const Component::HUDComponent* hud);
@@ -11,7 +11,7 @@
 #include "examples/zombie_survivor/events/GameEventTypes.hpp"
 #include "engine/core/ecs/systems/ParticleSystem.hpp"
 #include "engine/core/ecs/components/Transform2D.hpp"
-#include <iostream>
+#include "engine/core/log/Logger.hpp"
 
 namespace ZombieSurvivor::System {
 
@@ -24,7 +24,7 @@ void HealthSystem::Init() {
     // 订阅伤害事件
     eventManager.Subscribe(engine::event::EventType::CUSTOM, this);
     
-    std::cout << "[HealthSystem] Initialized and subscribed to damage events" << std::endl;
+    LOG_INFO("HealthSystem") << "Initialized and subscribed to damage events";
 }
 
 void HealthSystem::Update(float deltaTime) {
@@ -40,7 +40,7 @@ void HealthSystem::Shutdown() {
     // 取消订阅事件
     eventManager.Unsubscribe(engine::event::EventType::CUSTOM, this);
     
-    std::cout << "[HealthSystem] Shutdown and unsubscribed from events" << std::endl;
+    LOG_INFO("HealthSystem") << "Shutdown and unsubscribed from events";
 }
 
 void HealthSystem::onEvent(const std::shared_ptr<engine::event::Event>& event) {
@@ -60,7 +60,7 @@ void HealthSystem::ModifyHealth(uint32_t entityId, float amount) {
     if (!world) return;
     
     auto& componentManager = world->GetComponentManager();
-    auto* health = componentManager.GetComponent<ZombieSurvivor::Component::HealthComponent>(entityId);
+    auto* health = componentManager.GetMutableComponent<ZombieSurvivor::Component::HealthComponent>(entityId);
     
     if (!health || !health->isAlive) return;
     
@@ -83,7 +83,7 @@ void HealthSystem::SetMaxHealth(uint32_t entityId, float maxHealth) {
     if (!world) return;
 
     auto& componentManager = world->GetComponentManager();
-    auto* health = componentManager.GetComponent<ZombieSurvivor::Component::HealthComponent>(entityId);
+    auto* health = componentManager.GetMutableComponent<ZombieSurvivor::Component::HealthComponent>(entityId);
 
     if (!health) return;
 
@@ -101,7 +101,7 @@ void HealthSystem::RestoreToFull(uint32_t entityId) {
     if (!world) return;
 
     auto& componentManager = world->GetComponentManager();
-    auto* health = componentManager.GetComponent<ZombieSurvivor::Component::HealthComponent>(entityId);
+    auto* health = componentManager.GetMutableComponent<ZombieSurvivor::Component::HealthComponent>(entityId);
     
     if (!health) return;
 
@@ -117,13 +117,14 @@ void HealthSystem::ProcessDeathChecks() {
     if (!world) return;
     
     auto& componentManager = world->GetComponentManager();
-    auto entities = componentManager.GetEntitiesWithComponent<ZombieSurvivor::Component::HealthComponent>();
     
-    for (auto entityId : entities) {
-        auto* health = componentManager.GetComponent<ZombieSurvivor::Component::HealthComponent>(entityId);
-        if (!health) continue;
-        
-        if (health->health <= 0.0f && health->isAlive) {
+    // Health only drops through tracked writes (GetMutableComponent), so only
+    // entities whose health changed since the last check can have died
+    auto changed = componentManager.GetView<ZombieSurvivor::Component::HealthComponent>()
+        .Changed<ZombieSurvivor::Component::HealthComponent>(GetLastRunTick());
+    
+    for (auto [entityId, health] : changed) {
+        if (health.health <= 0.0f && health.isAlive) {
             ProcessDeath(entityId);
         }
     }
@@ -134,13 +135,13 @@ void HealthSystem::ProcessDeath(uint32_t entityId) {
     if (!world) return;
     
     auto& componentManager = world->GetComponentManager();
-    auto* health = componentManager.GetComponent<ZombieSurvivor::Component::HealthComponent>(entityId);
+    auto* health = componentManager.GetMutableComponent<ZombieSurvivor::Component::HealthComponent>(entityId);
     
     if (!health) return;
     
     health->isAlive = false;
     
-    std::cout << "[HealthSystem] Entity " << entityId << " died! Destroying entity..." << std::endl;
+    LOG_DEBUG("HealthSystem") << "Entity " << entityId << " died! Destroying entity...";
     
     // Create death particle effect
     auto* transform = componentManager.GetComponent<engine::ECS::Transform2D>(entityId);
@@ -157,7 +158,8 @@ void HealthSystem::ProcessDeath(uint32_t entityId) {
                     {transform->x, transform->y},
                     30,  // more particles
                     {255, 0, 0, 255},  // red color
-                    200.0f  // higher speed
+                    200.0f,  // higher speed
+                    &commandBuffer_
                 );
             }
         }
@@ -165,16 +167,11 @@ void HealthSystem::ProcessDeath(uint32_t entityId) {
     
     PublishDeathEvent(entityId);
     
-    // Use same cleanup pattern as ProjectileSystem to ensure complete removal
-    auto& entityFactory = world->GetEntityFactory();
-    
-    // 1. First remove all components (including Sprite2D to stop rendering)
-    componentManager.RemoveAllComponents(entityId);
-    
-    // 2. Then destroy the entity ID
-    entityFactory.DestroyEntity(entityId);
+    // Removes all components (including Sprite2D) and frees the ID once
+    // this system finishes, so the health loop above stays valid
+    commandBuffer_.DestroyEntity(entityId);
     
-    std::cout << "[HealthSystem] Entity " << entityId << " destroyed successfully with full component cleanup" << std::endl;
+    LOG_DEBUG("HealthSystem") << "Entity " << entityId << " queued for destruction";
 }
 
 void HealthSystem::PublishHealthChangedEvent(uint32_t entityId, float oldHealth, float newHealth) {
@@ -228,8 +225,8 @@ void HealthSystem::PublishDeathEvent(uint32_t entityId) {
         enemyKilledEvent->SetPriority(engine::event::EventPriority::HIGH);
         eventManager.Publish(enemyKilledEvent);
         
-        std::cout << "[HealthSystem] Enemy " << entityId << " killed! Exp reward: " 
-                  << enemyKilledData->expReward << " to player " << enemyKilledData->playerId << std::endl;
+        LOG_DEBUG("HealthSystem") << "Enemy " << entityId << " killed! Exp reward: " 
+                                 << enemyKilledData->expReward << " to player " << enemyKilledData->playerId;
     }
     
     // Always publish the general death event too
@@ -311,8 +308,8 @@ void HealthSystem::HandleDamageEvent(const std::shared_ptr<void>& eventData) {
     
     ModifyHealth(damageData->targetEntityId, -static_cast<float>(damageData->damageAmount));
     
-    std::cout << "[HealthSystem] Applied " << damageData->damageAmount 
-              << " damage to entity " << damageData->targetEntityId << std::endl;
+    LOG_DEBUG("HealthSystem") << "Applied " << damageData->damageAmount 
+                             << " damage to entity " << damageData->targetEntityId;
 }
 
 } // namespace ZombieSurvivor::System
@@ -4,6 +4,7 @@
 #include "engine/core/ecs/World.hpp"
 #include "engine/core/ecs/components/Tag.hpp"
 #include "examples/zombie_survivor/ecs/components/HealthComponent.hpp"
+#include "engine/core/log/Logger.hpp"
 #include <cmath>
 #include <algorithm>
 
@@ -47,18 +48,18 @@ void InputSystem::Update(float deltaTime) {
         
         // 测试血量减少 - 按X键减血，按C键加血
         if (inputManager_.IsKeyDown(SDLK_X)) {
-            auto* health = componentManager.GetComponent<ZombieSurvivor::Component::HealthComponent>(entityId);
+            auto* health = componentManager.GetMutableComponent<ZombieSurvivor::Component::HealthComponent>(entityId);
             if (health && health->health > 0) {
                 health->health = std::max(0.0f, health->health - 10.0f);  // 每次减10血
-                std::cout << "[InputSystem] Health decreased to: " << health->health << "/" << health->maxHealth << std::endl;
+                LOG_INFO("InputSystem") << "Health decreased to: " << health->health << "/" << health->maxHealth;
             }
         }
         
         if (inputManager_.IsKeyDown(SDLK_C)) {
-            auto* health = componentManager.GetComponent<ZombieSurvivor::Component::HealthComponent>(entityId);
+            auto* health = componentManager.GetMutableComponent<ZombieSurvivor::Component::HealthComponent>(entityId);
             if (health && health->health < health->maxHealth) {
                 health->health = std::min(health->maxHealth, health->health + 10.0f);  // 每次加10血
-                std::cout << "[InputSystem] Health increased to: " << health->health << "/" << health->maxHealth << std::endl;
+                LOG_INFO("InputSystem") << "Health increased to: " << health->health << "/" << health->maxHealth;
             }
         }
     }
@@ -75,7 +76,7 @@ bool InputSystem::IsShootButtonPressed() const {
 bool InputSystem::IsReloadButtonPressed() const {
     bool result = inputManager_.IsKeyDown(SDLK_R);
     if (result) {
-        std::cout << "[InputSystem] SDLK_R detected by InputManager!" << std::endl;
+        LOG_DEBUG("InputSystem") << "SDLK_R detected by InputManager!";
     }
     return result;
 }
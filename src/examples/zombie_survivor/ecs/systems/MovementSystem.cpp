@@ -16,20 +16,14 @@ void MovementSystem::Update(float deltaTime) {
 
     auto& componentManager = world->GetComponentManager();
 
-    auto entities = componentManager.GetEntitiesWithComponents<
+    auto view = componentManager.GetView<
         ZombieSurvivor::Component::InputComponent,
         ZombieSurvivor::Component::MovementComponent,
         engine::ECS::Velocity2D
     >();
 
-    for (const auto& entityId : entities) {
-        auto* input = componentManager.GetComponent<ZombieSurvivor::Component::InputComponent>(entityId);
-        auto* movement = componentManager.GetComponent<ZombieSurvivor::Component::MovementComponent>(entityId);
-        auto* velocity = componentManager.GetComponent<engine::ECS::Velocity2D>(entityId);
-
-        if (!input || !movement || !velocity) continue;
-
-        ProcessMovement(input, movement, velocity, deltaTime);
+    for (auto [entityId, input, movement, velocity] : view) {
+        ProcessMovement(&input, &movement, &velocity, deltaTime);
     }
 }
 
@@ -6,21 +6,21 @@
 #include "examples/zombie_survivor/ecs/components/ExperienceComponent.hpp"
 #include "examples/zombie_survivor/events/GameEventData.hpp"
 #include "engine/core/ecs/ComponentManager.hpp"
-#include <iostream>
+#include "engine/core/log/Logger.hpp"
 
 namespace ZombieSurvivor::System {
 
 void PlayerStatsSystem::Init() {
-    std::cout << "[PlayerStatsSystem] Initializing..." << std::endl;
+    LOG_INFO("PlayerStatsSystem") << "Initializing...";
     
     auto* world = GetWorld();
     if (world) {
         auto& eventManager = world->GetEventManager();
         eventManager.Subscribe(engine::event::EventType::CUSTOM, this);
-        std::cout << "[PlayerStatsSystem] Subscribed to events" << std::endl;
+        LOG_INFO("PlayerStatsSystem") << "Subscribed to events";
     }
     
-    std::cout << "[PlayerStatsSystem] ✅ Initialized successfully" << std::endl;
+    LOG_INFO("PlayerStatsSystem") << "✅ Initialized successfully";
 }
 
 void PlayerStatsSystem::Update(float deltaTime) {
@@ -36,10 +36,10 @@ void PlayerStatsSystem::Shutdown() {
     if (world) {
         auto& eventManager = world->GetEventManager();
         eventManager.Unsubscribe(engine::event::EventType::CUSTOM, this);
-        std::cout << "[PlayerStatsSystem] Unsubscribed from events" << std::endl;
+        LOG_INFO("PlayerStatsSystem") << "Unsubscribed from events";
     }
     
-    std::cout << "[PlayerStatsSystem] 🧹 Shutdown complete" << std::endl;
+    LOG_INFO("PlayerStatsSystem") << "🧹 Shutdown complete";
 }
 
 void PlayerStatsSystem::onEvent(const std::shared_ptr<engine::event::Event>& event) {
@@ -198,7 +198,7 @@ void PlayerStatsSystem::ResetStats(uint32_t playerId) {
         stats->totalDamageTaken = 0.0f;
         stats->totalDamageDealt = 0.0f;
         
-        std::cout << "[PlayerStatsSystem] 🔄 Stats reset for player " << playerId << std::endl;
+        LOG_INFO("PlayerStatsSystem") << "🔄 Stats reset for player " << playerId;
     }
 }
 
@@ -226,7 +226,7 @@ void PlayerStatsSystem::RecordDamage(uint32_t playerId, float damageDealt, float
 }
 
 void PlayerStatsSystem::PrintStatsUpdate(uint32_t playerId, const std::string& statName, const std::string& value) {
-    std::cout << "[PlayerStatsSystem] 📊 Player " << playerId << " - " << statName << ": " << value << std::endl;
+    LOG_DEBUG("PlayerStatsSystem") << "📊 Player " << playerId << " - " << statName << ": " << value;
 }
 
 } // namespace ZombieSurvivor::System
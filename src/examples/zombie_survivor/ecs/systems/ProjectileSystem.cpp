@@ -10,7 +10,7 @@
 #include "engine/core/ecs/components/PhysicsMode.hpp"
 #include "examples/zombie_survivor/ecs/components/ProjectileComponent.hpp"
 #include "examples/zombie_survivor/events/ProjectileEventUtils.hpp"
-#include <iostream>
+#include "engine/core/log/Logger.hpp"
 #include <iomanip>
 #include <cmath>
 
@@ -23,7 +23,19 @@ void ProjectileSystem::Init() {
     auto& eventManager = world->GetEventManager();
     eventManager.Subscribe(engine::event::EventType::CUSTOM, this);
 
-    std::cout << "[ProjectileSystem] Initialized and subscribed to events" << std::endl;
+    // Track projectiles however they enter or leave the world (command buffer
+    // flushes, entity destruction by other systems, world clears)
+    auto& componentManager = world->GetComponentManager();
+    projectileAddedObserver_ = componentManager.OnAdd<Component::ProjectileComponent>(
+        [this](engine::EntityID id, Component::ProjectileComponent&) {
+            activeProjectiles_.insert(id);
+        });
+    projectileRemovedObserver_ = componentManager.OnRemove<Component::ProjectileComponent>(
+        [this](engine::EntityID id, Component::ProjectileComponent&) {
+            activeProjectiles_.erase(id);
+        });
+
+    LOG_INFO("ProjectileSystem") << "Initialized and subscribed to events";
 }
 
 void ProjectileSystem::Update(float deltaTime) {
@@ -39,9 +51,13 @@ void ProjectileSystem::Shutdown() {
     
     auto& eventManager = world->GetEventManager();
     eventManager.Unsubscribe(engine::event::EventType::CUSTOM, this);
+
+    auto& componentManager = world->GetComponentManager();
+    componentManager.RemoveObserver(projectileAddedObserver_);
+    componentManager.RemoveObserver(projectileRemovedObserver_);
     
     activeProjectiles_.clear();
-    std::cout << "[ProjectileSystem] Shutdown complete" << std::endl;
+    LOG_INFO("ProjectileSystem") << "Shutdown complete";
 }
 
 void ProjectileSystem::onEvent(const std::shared_ptr<engine::event::Event>& event) {
@@ -75,15 +91,16 @@ void ProjectileSystem::HandleCreateProjectile(const std::shared_ptr<void>& event
         engine::EntityID oldestProjectile = FindOldestProjectile();
         if (oldestProjectile != 0) {
             DestroyProjectile(oldestProjectile);
-            std::cout << "[ProjectileSystem] Removed oldest projectile to make room for new one" << std::endl;
+            LOG_DEBUG("ProjectileSystem") << "Removed oldest projectile to make room for new one";
         } else {
-            std::cout << "[ProjectileSystem] Max projectiles reached, ignoring create request" << std::endl;
+            LOG_INFO("ProjectileSystem") << "Max projectiles reached, ignoring create request";
             return;
         }
     }
     
     engine::EntityID projectileId = CreateProjectileEntity(*data);
     if (projectileId != 0) {
+        // Counted right away so the cap holds before the buffer flushes
         activeProjectiles_.insert(projectileId);
         
         auto* world = GetWorld();
@@ -103,11 +120,11 @@ void ProjectileSystem::HandleCreateProjectile(const std::shared_ptr<void>& event
             eventManager.Publish(event);
         }
         
-        std::cout << "[ProjectileSystem] Created projectile " << projectileId 
-                  << " for shooter " << data->shooterId 
-                  << " at (" << std::fixed << std::setprecision(1) << data->startPosition.x << ", " << data->startPosition.y << ")"
-                  << " - Expected range: " << (data->speed * data->lifetime) << "px"
-                  << " (speed=" << data->speed << "px/s, lifetime=" << std::setprecision(3) << data->lifetime << "s)" << std::endl;
+        LOG_DEBUG("ProjectileSystem") << "Created projectile " << projectileId 
+                                     << " for shooter " << data->shooterId 
+                                     << " at (" << std::fixed << std::setprecision(1) << data->startPosition.x << ", " << data->startPosition.y << ")"
+                                     << " - Expected range: " << (data->speed * data->lifetime) << "px"
+                                     << " (speed=" << data->speed << "px/s, lifetime=" << std::setprecision(3) << data->lifetime << "s)";
     }
 }
 
@@ -131,8 +148,8 @@ void ProjectileSystem::HandleProjectileDestroyed(const std::shared_ptr<void>& ev
             projectile->shouldDestroy = false;
         }
         
-        std::cout << "[ProjectileSystem] Projectile " << data->projectileId 
-                  << " hit target, remaining penetration: " << projectile->penetration << std::endl;
+        LOG_DEBUG("ProjectileSystem") << "Projectile " << data->projectileId 
+                                     << " hit target, remaining penetration: " << projectile->penetration;
     }
 }
 
@@ -140,20 +157,18 @@ engine::EntityID ProjectileSystem::CreateProjectileEntity(const ZombieSurvivor::
     auto* world = GetWorld();
     if (!world) return 0;
     
-    auto& entityFactory = world->GetEntityFactory();
-    auto& componentManager = world->GetComponentManager();
-    
-    engine::EntityID projectileId = entityFactory.CreateEntity("Projectile");
+    // Components are queued and land when this system's buffer is flushed
+    engine::EntityID projectileId = commandBuffer_.CreateEntity("Projectile");
     
-    componentManager.AddComponent<engine::ECS::Transform2D>(projectileId,
+    commandBuffer_.AddComponent<engine::ECS::Transform2D>(projectileId,
         engine::ECS::Transform2D{data.startPosition.x, data.startPosition.y, 0.0f, 1.0f, 1.0f});
     
     engine::Vector2 velocity = data.direction * data.speed;
-    componentManager.AddComponent<engine::ECS::Velocity2D>(projectileId,
+    commandBuffer_.AddComponent<engine::ECS::Velocity2D>(projectileId,
         engine::ECS::Velocity2D{velocity.x, velocity.y, data.speed});
     
     // Add PhysicsModeComponent for PhysicsSystem to process movement
-    componentManager.AddComponent<engine::ECS::PhysicsModeComponent>(projectileId,
+    commandBuffer_.AddComponent<engine::ECS::PhysicsModeComponent>(projectileId,
         engine::ECS::PhysicsModeComponent{
             engine::ECS::PhysicsMode::TOP_DOWN,  // 2D physics mode
             0.0f, 0.0f, 0.0f,                    // no gravity
@@ -162,11 +177,11 @@ engine::EntityID ProjectileSystem::CreateProjectileEntity(const ZombieSurvivor::
             1.0f                                 // friction factor (unused when friction disabled)
         });
     
-    componentManager.AddComponent<engine::ECS::Collider2D>(projectileId,
+    commandBuffer_.AddComponent<engine::ECS::Collider2D>(projectileId,
         engine::ECS::Collider2D{{0, 0, 4, 4}, false, "projectile"});
     
     // Add Sprite2D component to make projectile visible
-    componentManager.AddComponent<engine::ECS::Sprite2D>(projectileId,
+    commandBuffer_.AddComponent<engine::ECS::Sprite2D>(projectileId,
         engine::ECS::Sprite2D{
             "pixel.png",                    // texture path
             {0, 0, 8, 8},                   // sourceRect - bigger 8x8 bullet for visibility
@@ -188,9 +203,9 @@ engine::EntityID ProjectileSystem::CreateProjectileEntity(const ZombieSurvivor::
     projectile.penetration = data.penetration;
     projectile.spread = data.spread;
     
-    componentManager.AddComponent<Component::ProjectileComponent>(projectileId, projectile);
+    commandBuffer_.AddComponent<Component::ProjectileComponent>(projectileId, projectile);
     
-    componentManager.AddComponent<engine::ECS::Tag>(projectileId, 
+    commandBuffer_.AddComponent<engine::ECS::Tag>(projectileId, 
         engine::ECS::Tag{"projectile"});
     
     return projectileId;
@@ -227,12 +242,12 @@ void ProjectileSystem::UpdateProjectileMovement(float deltaTime) {
             
             // Debug output every 0.1 seconds (roughly every 6 frames at 60fps)
             if (static_cast<int>(projectile->currentLifetime * 10) != static_cast<int>((projectile->currentLifetime - deltaTime) * 10)) {
-                std::cout << "[DEBUG] Projectile " << projectileId 
-                          << " - Time: " << std::fixed << std::setprecision(3) << projectile->currentLifetime
-                          << "s, Traveled: " << std::setprecision(1) << projectile->distanceTraveled 
-                          << "px, Actual: " << actualDistance 
-                          << "px, Pos: (" << transform->x << ", " << transform->y << ")"
-                          << ", Start: (" << projectile->startPosition.x << ", " << projectile->startPosition.y << ")" << std::endl;
+                LOG_DEBUG("ProjectileSystem") << "Projectile " << projectileId 
+                                              << " - Time: " << std::fixed << std::setprecision(3) << projectile->currentLifetime
+                                              << "s, Traveled: " << std::setprecision(1) << projectile->distanceTraveled 
+                                              << "px, Actual: " << actualDistance 
+                                              << "px, Pos: (" << transform->x << ", " << transform->y << ")"
+                                              << ", Start: (" << projectile->startPosition.x << ", " << projectile->startPosition.y << ")";
             }
         }
     }
@@ -252,10 +267,10 @@ void ProjectileSystem::UpdateProjectileLifetime(float deltaTime) {
             
             if (projectile->currentLifetime >= projectile->maxLifetime) {
                 projectile->shouldDestroy = true;
-                std::cout << "[ProjectileSystem] Projectile " << projectileId 
-                          << " EXPIRED after " << std::fixed << std::setprecision(3) << projectile->currentLifetime 
-                          << "s (max: " << projectile->maxLifetime << "s)"
-                          << " - Distance traveled: " << std::setprecision(1) << projectile->distanceTraveled << "px" << std::endl;
+                LOG_DEBUG("ProjectileSystem") << "Projectile " << projectileId 
+                                             << " EXPIRED after " << std::fixed << std::setprecision(3) << projectile->currentLifetime 
+                                             << "s (max: " << projectile->maxLifetime << "s)"
+                                             << " - Distance traveled: " << std::setprecision(1) << projectile->distanceTraveled << "px";
             }
         }
     }
@@ -276,11 +291,11 @@ void ProjectileSystem::HandleBoundaryChecks() {
             if (transform->x < -worldBounds_.x || transform->x > worldBounds_.x ||
                 transform->y < -worldBounds_.y || transform->y > worldBounds_.y) {
                 projectile->shouldDestroy = true;
-                std::cout << "[ProjectileSystem] Projectile " << projectileId 
-                          << " HIT BOUNDARY at (" << std::fixed << std::setprecision(1) << transform->x << ", " << transform->y << ")"
-                          << " after " << std::setprecision(3) << projectile->currentLifetime << "s"
-                          << " - Distance: " << std::setprecision(1) << projectile->distanceTraveled << "px"
-                          << " [BOUNDARY BOUNDS: " << worldBounds_.x << "x" << worldBounds_.y << "]" << std::endl;
+                LOG_DEBUG("ProjectileSystem") << "Projectile " << projectileId 
+                                             << " HIT BOUNDARY at (" << std::fixed << std::setprecision(1) << transform->x << ", " << transform->y << ")"
+                                             << " after " << std::setprecision(3) << projectile->currentLifetime << "s"
+                                             << " - Distance: " << std::setprecision(1) << projectile->distanceTraveled << "px"
+                                             << " [BOUNDARY BOUNDS: " << worldBounds_.x << "x" << worldBounds_.y << "]";
             }
         }
     }
@@ -291,11 +306,8 @@ void ProjectileSystem::CleanupExpiredProjectiles() {
     if (!world) return;
     
     auto& componentManager = world->GetComponentManager();
-    auto& entityFactory = world->GetEntityFactory();
-    
-    // 使用迭代器安全地遍历并修改activeProjectiles_集合
-    std::vector<engine::EntityID> toRemove;
     
+    // activeProjectiles_ drops the entry via the OnRemove observer at flush time
     for (auto projectileId : activeProjectiles_) {
         auto* projectile = componentManager.GetComponent<Component::ProjectileComponent>(projectileId);
         
@@ -305,36 +317,17 @@ void ProjectileSystem::CleanupExpiredProjectiles() {
             auto* sprite = componentManager.GetComponent<engine::ECS::Sprite2D>(projectileId);
             auto* velocity = componentManager.GetComponent<engine::ECS::Velocity2D>(projectileId);
             
-            std::cout << "[ProjectileSystem] BEFORE cleanup - Projectile " << projectileId 
-                      << " Components: Transform=" << (transform ? "YES" : "NO")
-                      << ", Sprite=" << (sprite ? "YES" : "NO")
-                      << ", Velocity=" << (velocity ? "YES" : "NO") << std::endl;
-            
-            // Use ComponentManager's unified cleanup - removes ALL components
-            componentManager.RemoveAllComponents(projectileId);
-            
-            // Then destroy entity ID from EntityFactory
-            entityFactory.DestroyEntity(projectileId);
-            toRemove.push_back(projectileId);
+            LOG_DEBUG("ProjectileSystem") << "BEFORE cleanup - Projectile " << projectileId 
+                                         << " Components: Transform=" << (transform ? "YES" : "NO")
+                                         << ", Sprite=" << (sprite ? "YES" : "NO")
+                                         << ", Velocity=" << (velocity ? "YES" : "NO");
             
-            // Debug: Verify all components are gone
-            transform = componentManager.GetComponent<engine::ECS::Transform2D>(projectileId);
-            sprite = componentManager.GetComponent<engine::ECS::Sprite2D>(projectileId);
-            velocity = componentManager.GetComponent<engine::ECS::Velocity2D>(projectileId);
+            // Removes ALL components and frees the ID when the buffer flushes
+            commandBuffer_.DestroyEntity(projectileId);
             
-            std::cout << "[ProjectileSystem] AFTER unified cleanup - Projectile " << projectileId 
-                      << " Components: Transform=" << (transform ? "YES" : "NO")
-                      << ", Sprite=" << (sprite ? "YES" : "NO")
-                      << ", Velocity=" << (velocity ? "YES" : "NO") << std::endl;
-            
-            std::cout << "[ProjectileSystem] Cleaned up projectile " << projectileId << std::endl;
+            LOG_DEBUG("ProjectileSystem") << "Cleaned up projectile " << projectileId;
         }
     }
-    
-    // 从activeProjectiles_中移除已清理的projectile
-    for (auto projectileId : toRemove) {
-        activeProjectiles_.erase(projectileId);
-    }
 }
 
 engine::EntityID ProjectileSystem::FindOldestProjectile() {
@@ -357,13 +350,13 @@ engine::EntityID ProjectileSystem::FindOldestProjectile() {
 }
 
 void ProjectileSystem::DestroyProjectile(engine::EntityID projectileId) {
+    // Erased now so FindOldestProjectile() can't pick it again before the flush
     activeProjectiles_.erase(projectileId);
     
     auto* world = GetWorld();
     if (world) {
-        // Use unified cleanup for consistency
-        world->GetComponentManager().RemoveAllComponents(projectileId);
-        world->GetEntityFactory().DestroyEntity(projectileId);
+        // Same deferred cleanup as CleanupExpiredProjectiles
+        commandBuffer_.DestroyEntity(projectileId);
     }
 }
 
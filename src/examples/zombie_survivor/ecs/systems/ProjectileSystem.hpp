@@ -37,6 +37,8 @@ private:
     engine::EntityID FindOldestProjectile();
     void DestroyProjectile(engine::EntityID projectileId);
     std::unordered_set<engine::EntityID> activeProjectiles_;
+    engine::ECS::ComponentManager::ObserverHandle projectileAddedObserver_;
+    engine::ECS::ComponentManager::ObserverHandle projectileRemovedObserver_;
     
     engine::Vector2 worldBounds_{2000.0f, 2000.0f};
     size_t maxActiveProjectiles_ = 200;
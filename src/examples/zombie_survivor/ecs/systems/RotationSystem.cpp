@@ -2,12 +2,12 @@
 
 #include "RotationSystem.hpp"
 #include "engine/core/ecs/World.hpp"
-#include <iostream>
+#include "engine/core/log/Logger.hpp"
 
 namespace ZombieSurvivor::System {
 
 void RotationSystem::Init() {
-    std::cout << "[RotationSystem] Initialized" << std::endl;
+    LOG_INFO("RotationSystem") << "Initialized";
 }
 
 void RotationSystem::Update(float deltaTime) {
@@ -32,7 +32,7 @@ void RotationSystem::Update(float deltaTime) {
 
 void RotationSystem::Shutdown() {
     rotationSmoothing_.clear();
-    std::cout << "[RotationSystem] Shutdown" << std::endl;
+    LOG_INFO("RotationSystem") << "Shutdown";
 }
 
 float RotationSystem::GetCurrentRotation(uint32_t entityId) const {
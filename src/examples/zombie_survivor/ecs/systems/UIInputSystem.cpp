@@ -4,7 +4,7 @@
 #include "engine/core/ecs/World.hpp"
 #include "engine/core/event/EventManager.hpp"
 #include "engine/core/event/events/InputEvents.hpp"
-#include <iostream>
+#include "engine/core/log/Logger.hpp"
 #include <algorithm>
 
 namespace ZombieSurvivor::System {
@@ -19,7 +19,7 @@ void UIInputSystem::Init() {
     eventManager.Subscribe(engine::event::EventType::KEY_DOWN, this);
     eventManager.Subscribe(engine::event::EventType::KEY_UP, this);
     
-    std::cout << "[UIInputSystem] Initialized and subscribed to input events" << std::endl;
+    LOG_INFO("UIInputSystem") << "Initialized and subscribed to input events";
 }
 
 void UIInputSystem::Update(float deltaTime) {
@@ -44,7 +44,7 @@ void UIInputSystem::Shutdown() {
     eventManager.Unsubscribe(engine::event::EventType::KEY_DOWN, this);
     eventManager.Unsubscribe(engine::event::EventType::KEY_UP, this);
     
-    std::cout << "[UIInputSystem] Shutdown and unsubscribed from input events" << std::endl;
+    LOG_INFO("UIInputSystem") << "Shutdown and unsubscribed from input events";
 }
 
 void UIInputSystem::onEvent(const std::shared_ptr<engine::event::Event>& event) {
@@ -72,7 +72,7 @@ void UIInputSystem::SetFocusedElement(uint32_t uiEntityId) {
     if (uiEntityId != 0) {
         auto* ui = GetUIComponent(uiEntityId);
         if (ui && ui->interactive) {
-            std::cout << "[UIInputSystem] Set focus to element " << uiEntityId << std::endl;
+            LOG_INFO("UIInputSystem") << "Set focus to element " << uiEntityId;
         }
     }
 }
@@ -366,8 +366,8 @@ void UIInputSystem::DebugLogInteraction(const std::string& action, uint32_t elem
     #ifdef DEBUG
     auto* ui = GetUIComponent(elementId);
     std::string elementName = ui ? ui->elementId : "Unknown";
-    std::cout << "[UIInputSystem] " << action << " on element " << elementId 
-              << " (" << elementName << ")" << std::endl;
+    LOG_DEBUG("UIInputSystem") << action << " on element " << elementId 
+                               << " (" << elementName << ")";
     #endif
 }
 
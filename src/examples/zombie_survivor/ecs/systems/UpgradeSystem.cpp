@@ -9,7 +9,7 @@
 #include "examples/zombie_survivor/ecs/components/WeaponComponent.hpp"
 #include "examples/zombie_survivor/events/GameEventTypes.hpp"
 #include "examples/zombie_survivor/events/GameEventData.hpp"
-#include <iostream>
+#include "engine/core/log/Logger.hpp"
 #include <algorithm>
 
 namespace ZombieSurvivor::System {
@@ -23,7 +23,7 @@ void UpgradeSystem::Init() {
 
     rng_.seed(std::random_device{}());
 
-    std::cout << "[UpgradeSystem Initialized" << std::endl;
+    LOG_INFO("UpgradeSystem") << "Initialized";
 }
 
 void UpgradeSystem::Update(float deltaTime) {
@@ -70,8 +70,8 @@ void UpgradeSystem::HandleLevelUpEvent(const std::shared_ptr<void>& eventData) {
         upgrade->pendingUpgrade = true;
         upgrade->currentOptions = GenerateUpgradeOptions(3);
 
-        std::cout << "[UpgradeSystem] Player " << playerId 
-        << " can choose from 3 upgrade options" << std::endl;
+        LOG_INFO("UpgradeSystem") << "Player " << playerId 
+        << " can choose from 3 upgrade options";
     }
 }
 
@@ -105,8 +105,8 @@ void UpgradeSystem::SelectUpgrade(uint32_t entityId, Component::UpgradeType upgr
     upgrade->pendingUpgrade = false;
     upgrade->currentOptions.clear();
     
-    std::cout << "[UpgradeSystem] Applied " << static_cast<int>(upgradeType) 
-              << " upgrade to entity " << entityId << std::endl;
+    LOG_INFO("UpgradeSystem") << "Applied " << static_cast<int>(upgradeType) 
+                              << " upgrade to entity " << entityId;
 }
 
 void UpgradeSystem::ApplyUpgradeEffect(uint32_t entityId, Component::UpgradeType upgradeType) {
@@ -120,7 +120,7 @@ void UpgradeSystem::ApplyUpgradeEffect(uint32_t entityId, Component::UpgradeType
             auto* weapon = componentManager.GetComponent<Component::WeaponComponent>(entityId);
             if (weapon) {
                 weapon->damage += 5.0f;
-                std::cout << "[UpgradeSystem] Damage increased to " << weapon->damage << std::endl;
+                LOG_INFO("UpgradeSystem") << "Damage increased to " << weapon->damage;
             }
             break;
         }
@@ -128,16 +128,16 @@ void UpgradeSystem::ApplyUpgradeEffect(uint32_t entityId, Component::UpgradeType
             auto* movement = componentManager.GetComponent<Component::MovementComponent>(entityId);
             if (movement) {
                 movement->speed += 25.0f;
-                std::cout << "[UpgradeSystem] Speed increased to " << movement->speed << std::endl;
+                LOG_INFO("UpgradeSystem") << "Speed increased to " << movement->speed;
             }
             break;
         }
         case Component::UpgradeType::MAX_HEALTH_BOOST: {
-            auto* health = componentManager.GetComponent<Component::HealthComponent>(entityId);
+            auto* health = componentManager.GetMutableComponent<Component::HealthComponent>(entityId);
             if (health) {
                 health->maxHealth += 25.0f;
                 health->health += 25.0f;
-                std::cout << "[UpgradeSystem] Max health increased to " << health->maxHealth << std::endl;
+                LOG_INFO("UpgradeSystem") << "Max health increased to " << health->maxHealth;
             }
             break;
         }
@@ -145,7 +145,7 @@ void UpgradeSystem::ApplyUpgradeEffect(uint32_t entityId, Component::UpgradeType
             auto* weapon = componentManager.GetComponent<Component::WeaponComponent>(entityId);
             if (weapon) {
                 weapon->fireRate += 1.0f;
-                std::cout << "[UpgradeSystem] Fire rate increased to " << weapon->fireRate << std::endl;
+                LOG_INFO("UpgradeSystem") << "Fire rate increased to " << weapon->fireRate;
             }
             break;
         }
@@ -153,7 +153,7 @@ void UpgradeSystem::ApplyUpgradeEffect(uint32_t entityId, Component::UpgradeType
             auto* weapon = componentManager.GetComponent<Component::WeaponComponent>(entityId);
             if (weapon) {
                 weapon->magazineCapacity += 3;
-                std::cout << "[UpgradeSystem] Magazine size increased to " << weapon->magazineCapacity << std::endl;
+                LOG_INFO("UpgradeSystem") << "Magazine size increased to " << weapon->magazineCapacity;
             }
             break;
         }
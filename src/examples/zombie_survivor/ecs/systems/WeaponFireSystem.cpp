@@ -10,23 +10,23 @@
 #include "examples/zombie_survivor/ecs/components/InputComponent.hpp"
 #include "examples/zombie_survivor/ecs/components/FollowComponent.hpp"
 #include "examples/zombie_survivor/configs/ProjectileConfig.hpp"
-#include <iostream>
+#include "engine/core/log/Logger.hpp"
 #include <cmath>
 
 namespace ZombieSurvivor::System {
 
 void WeaponFireSystem::Init() {
-    std::cout << "[WeaponFireSystem] Init() called" << std::endl;
+    LOG_INFO("WeaponFireSystem") << "Init() called";
     auto* world = GetWorld();
     if (!world) {
-        std::cout << "[WeaponFireSystem] ERROR: No world available during Init!" << std::endl;
+        LOG_ERROR("WeaponFireSystem") << "No world available during Init!";
         return;
     }
 
     auto& eventManager = world->GetEventManager();
     eventManager.Subscribe(engine::event::EventType::CUSTOM, this);
     
-    std::cout << "[WeaponFireSystem] Initialized and subscribed to CUSTOM events" << std::endl;
+    LOG_INFO("WeaponFireSystem") << "Initialized and subscribed to CUSTOM events";
 }
 
 void WeaponFireSystem::Update(float deltaTime) {
@@ -40,7 +40,7 @@ void WeaponFireSystem::Shutdown() {
     auto& eventManager = world->GetEventManager();
     eventManager.Unsubscribe(engine::event::EventType::CUSTOM, this);
     
-    std::cout << "[WeaponFireSystem] Shutdown" << std::endl;
+    LOG_INFO("WeaponFireSystem") << "Shutdown";
 }
 
 void WeaponFireSystem::onEvent(const std::shared_ptr<engine::event::Event>& event) {
@@ -74,14 +74,14 @@ void WeaponFireSystem::HandleFireInput(uint32_t playerId) {
     
     // Check if weapon is ready (cooldown, reloading) 
     if (!CanFire(playerId)) {
-        std::cout << "[WeaponFireSystem] Player " << playerId << " weapon not ready (cooldown/reloading) - REJECTED SHOT ATTEMPT" << std::endl;
+        LOG_DEBUG("WeaponFireSystem") << "Player " << playerId << " weapon not ready (cooldown/reloading) - REJECTED SHOT ATTEMPT";
         return;
     }
     
     // Get weapon's ammo type
     Component::AmmoType ammoType = GetWeaponAmmoType(playerId);
     if (ammoType == Component::AmmoType::NONE) {
-        std::cout << "[WeaponFireSystem] Player " << playerId << " weapon has invalid ammo type" << std::endl;
+        LOG_DEBUG("WeaponFireSystem") << "Player " << playerId << " weapon has invalid ammo type";
         return;
     }
     
@@ -93,9 +93,9 @@ void WeaponFireSystem::HandleFireInput(uint32_t playerId) {
         // Notify WeaponSystem for cooldown
         PublishWeaponFiredEvent(playerId);
         
-        std::cout << "[WeaponFireSystem] Successfully fired projectile for player " << playerId << std::endl;
+        LOG_DEBUG("WeaponFireSystem") << "Successfully fired projectile for player " << playerId;
     } else {
-        std::cout << "[WeaponFireSystem] Failed to consume ammo for player " << playerId << std::endl;
+        LOG_ERROR("WeaponFireSystem") << "Failed to consume ammo for player " << playerId;
     }
 }
 
@@ -141,8 +141,8 @@ bool WeaponFireSystem::TryConsumeAmmo(uint32_t playerId, Component::AmmoType amm
     // Consume ammo directly
     ammo->currentAmmo -= amount;
     
-    std::cout << "[WeaponFireSystem] Consumed " << amount << " ammo for player " << playerId 
-              << ", remaining: " << ammo->currentAmmo << "/" << ammo->totalAmmo << std::endl;
+    LOG_DEBUG("WeaponFireSystem") << "Consumed " << amount << " ammo for player " << playerId 
+                                 << ", remaining: " << ammo->currentAmmo << "/" << ammo->totalAmmo;
     
     return true;
 }
@@ -241,10 +241,10 @@ void WeaponFireSystem::CreateProjectile(uint32_t playerId, Component::AmmoType a
     );
     eventManager.Publish(projectileEvent);
     
-    std::cout << "[WeaponFireSystem] Created " << static_cast<int>(ammoType) 
-              << " projectile for player " << playerId 
-              << " (damage=" << projectileConfig.damage 
-              << ", speed=" << projectileConfig.speed << ")" << std::endl;
+    LOG_DEBUG("WeaponFireSystem") << "Created " << static_cast<int>(ammoType) 
+                                 << " projectile for player " << playerId 
+                                 << " (damage=" << projectileConfig.damage 
+                                 << ", speed=" << projectileConfig.speed << ")";
 }
 
 engine::EntityID WeaponFireSystem::FindWeaponEntityForPlayer(uint32_t playerId) const {
@@ -269,7 +269,7 @@ engine::EntityID WeaponFireSystem::FindWeaponEntityForPlayer(uint32_t playerId)
         }
     }
     
-    std::cout << "[WeaponFireSystem] No weapon found for player " << playerId << std::endl;
+    LOG_DEBUG("WeaponFireSystem") << "No weapon found for player " << playerId;
     return 0; // No weapon found
 }
 
@@ -1,13 +1,13 @@
 #include "WeaponFollowSystem.hpp"
 #include "engine/core/ecs/World.hpp"
 #include "examples/zombie_survivor/ecs/components/InputComponent.hpp"
-#include <iostream>
+#include "engine/core/log/Logger.hpp"
 #include <cmath>
 
 namespace ZombieSurvivor::System {
 
 void WeaponFollowSystem::Init() {
-    std::cout << "[WeaponFollowSystem] Initialized" << std::endl;
+    LOG_INFO("WeaponFollowSystem") << "Initialized";
 }
 
 void WeaponFollowSystem::Update(float deltaTime) {
@@ -34,8 +34,9 @@ void WeaponFollowSystem::UpdateFollowPosition(engine::EntityID followerId, const
 
     auto& componentManager = world->GetComponentManager();
     
-    // Get the follower's transform
-    auto* followerTransform = componentManager.GetComponent<engine::ECS::Transform2D>(followerId);
+    // Get the follower's transform (tracked write: culling and other
+    // Changed<Transform2D> readers must see the move)
+    auto* followerTransform = componentManager.GetMutableComponent<engine::ECS::Transform2D>(followerId);
     if (!followerTransform) return;
 
     // Get the target's transform (player)
@@ -91,7 +92,7 @@ void WeaponFollowSystem::CopyInputFromPlayer(engine::EntityID weaponId, const Co
 }
 
 void WeaponFollowSystem::Shutdown() {
-    std::cout << "[WeaponFollowSystem] Shutdown" << std::endl;
+    LOG_INFO("WeaponFollowSystem") << "Shutdown";
 }
 
 } // namespace ZombieSurvivor::System
\ No newline at end of file
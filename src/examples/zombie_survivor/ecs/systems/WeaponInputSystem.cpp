@@ -5,12 +5,12 @@
 #include "engine/core/event/EventManager.hpp"
 #include "examples/zombie_survivor/events/GameEventData.hpp"
 #include "examples/zombie_survivor/events/GameEventTypes.hpp"
-#include <iostream>
+#include "engine/core/log/Logger.hpp"
 
 namespace ZombieSurvivor::System {
 
 void WeaponInputSystem::Init() {
-    std::cout << "[WeaponInputSystem] Initialized" << std::endl;
+    LOG_INFO("WeaponInputSystem") << "Initialized";
 }
 
 void WeaponInputSystem::Update(float deltaTime) {
@@ -50,7 +50,7 @@ void WeaponInputSystem::Update(float deltaTime) {
 }
 
 void WeaponInputSystem::Shutdown() {
-    std::cout << "[WeaponInputSystem] Shutdown" << std::endl;
+    LOG_INFO("WeaponInputSystem") << "Shutdown";
 }
 
 void WeaponInputSystem::ProcessShootInput(uint32_t playerId, bool shootPressed) {
@@ -61,7 +61,7 @@ void WeaponInputSystem::ProcessShootInput(uint32_t playerId, bool shootPressed)
 
 void WeaponInputSystem::ProcessReloadInput(uint32_t playerId, bool reloadPressed) {
     if (reloadPressed) {
-        std::cout << "[WeaponInputSystem] Reload button pressed for player " << playerId << std::endl;
+        LOG_DEBUG("WeaponInputSystem") << "Reload button pressed for player " << playerId;
         PublishReloadInput(playerId);
     }
 }
@@ -107,8 +107,8 @@ void WeaponInputSystem::PublishReloadInput(uint32_t playerId) {
     );
     eventManager.Publish(reloadEvent);
     
-    std::cout << "[WeaponInputSystem] Published RELOAD_INPUT event for player " << playerId 
-              << " (type: " << static_cast<int>(Events::GameEventType::RELOAD_INPUT) << ")" << std::endl;
+    LOG_DEBUG("WeaponInputSystem") << "Published RELOAD_INPUT event for player " << playerId 
+                                  << " (type: " << static_cast<int>(Events::GameEventType::RELOAD_INPUT) << ")";
 }
 
 void WeaponInputSystem::PublishWeaponSwitchInput(uint32_t playerId, int weaponSlot) {
@@ -127,8 +127,8 @@ void WeaponInputSystem::PublishWeaponSwitchInput(uint32_t playerId, int weaponSl
     );
     eventManager.Publish(switchEvent);
     
-    std::cout << "[WeaponInputSystem] Player " << playerId 
-              << " switching to weapon slot " << weaponSlot << std::endl;
+    LOG_DEBUG("WeaponInputSystem") << "Player " << playerId 
+                                  << " switching to weapon slot " << weaponSlot;
 }
 
 } // namespace ZombieSurvivor::System
\ No newline at end of file
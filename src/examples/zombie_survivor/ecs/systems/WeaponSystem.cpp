@@ -5,7 +5,7 @@
 #include "engine/core/event/EventManager.hpp"
 #include "examples/zombie_survivor/events/GameEventData.hpp"
 #include "examples/zombie_survivor/ecs/components/WeaponComponent.hpp"
-#include <iostream>
+#include "engine/core/log/Logger.hpp"
 #include <algorithm>
 
 namespace ZombieSurvivor::System {
@@ -17,7 +17,7 @@ void WeaponSystem::Init() {
     auto& eventManager = world->GetEventManager();
     eventManager.Subscribe(engine::event::EventType::CUSTOM, this);
 
-    std::cout << "[WeaponSystem] Initialized" << std::endl;
+    LOG_INFO("WeaponSystem") << "Initialized";
 }
 
 void WeaponSystem::Update(float deltaTime) {
@@ -33,7 +33,7 @@ void WeaponSystem::Shutdown() {
     eventManager.Unsubscribe(engine::event::EventType::CUSTOM, this);
     
     playerWeaponStates_.clear();
-    std::cout << "[WeaponSystem] Shutdown" << std::endl;
+    LOG_INFO("WeaponSystem") << "Shutdown";
 }
 
 void WeaponSystem::onEvent(const std::shared_ptr<engine::event::Event>& event) {
@@ -95,7 +95,7 @@ void WeaponSystem::UpdateWeaponReloads(float deltaTime) {
                 // Notify reload completion
                 OnReloadCompleted(playerId);
     
-                std::cout << "[WeaponSystem] Player " << playerId << " completed reload" << std::endl;
+                LOG_DEBUG("WeaponSystem") << "Player " << playerId << " completed reload";
 }
         }
     }
@@ -142,7 +142,7 @@ void WeaponSystem::OnReloadStarted(uint32_t playerId) {
     
     // Check if already reloading
     if (state.isReloading) {
-        std::cout << "[WeaponSystem] Player " << playerId << " already reloading" << std::endl;
+        LOG_DEBUG("WeaponSystem") << "Player " << playerId << " already reloading";
         return;
     }
     
@@ -166,8 +166,8 @@ void WeaponSystem::OnReloadStarted(uint32_t playerId) {
     eventManager.Publish(reloadEvent);
 }
 
-    std::cout << "[WeaponSystem] Player " << playerId << " started reload, time: " 
-              << state.reloadTime << "s" << std::endl;
+    LOG_DEBUG("WeaponSystem") << "Player " << playerId << " started reload, time: " 
+                             << state.reloadTime << "s";
 }
 
 void WeaponSystem::OnReloadCompleted(uint32_t playerId) {
@@ -199,8 +199,8 @@ void WeaponSystem::OnWeaponSwitched(uint32_t playerId, float fireRate, float rel
     state.isReloading = false;
     state.reloadTimer = 0.0f;
     
-    std::cout << "[WeaponSystem] Player " << playerId << " switched weapon, "
-              << "fireRate: " << fireRate << ", reloadTime: " << reloadTime << std::endl;
+    LOG_INFO("WeaponSystem") << "Player " << playerId << " switched weapon, "
+                             << "fireRate: " << fireRate << ", reloadTime: " << reloadTime;
 }
 
 WeaponSystem::WeaponState& WeaponSystem::GetOrCreateWeaponState(uint32_t playerId) {
@@ -9,7 +9,7 @@
 #include "examples/zombie_survivor/ecs/components/TargetComponent.hpp"
 #include "examples/zombie_survivor/ecs/components/HealthComponent.hpp"
 #include "engine/core/Types.hpp"  // Add this for Vector2
-#include <iostream>
+#include "engine/core/log/Logger.hpp"
 #include <algorithm>
 
 namespace ZombieSurvivor::System {
@@ -17,8 +17,20 @@ namespace ZombieSurvivor::System {
 using EntityID = engine::ECS::EntityID;  // Add this for EntityID
 using Vector2 = engine::Vector2;          // Add this for Vector2
 
+// Base AISystem access plus what targeting and sprite state touch
+engine::ECS::SystemAccess ZombieAISystem::GetAccess() const {
+    return engine::ECS::SystemAccess()
+        .Read<engine::ECS::Transform2D>()
+        .Read<engine::ECS::Tag>()
+        .Read<ZombieSurvivor::Component::HealthComponent>()
+        .Write<engine::ECS::AIComponent>()
+        .Write<engine::ECS::Velocity2D>()
+        .Write<ZombieSurvivor::Component::TargetComponent>()
+        .Write<engine::ECS::SpriteStateComponent>();
+}
+
 void ZombieAISystem::Init() {
-    std::cout << "[ZombieAISystem] Initialized" << std::endl;
+    LOG_INFO("ZombieAISystem") << "Initialized";
 }
 
 void ZombieAISystem::Update(float deltaTime) {
@@ -26,7 +38,7 @@ void ZombieAISystem::Update(float deltaTime) {
 }
 
 void ZombieAISystem::Shutdown() {
-    std::cout << "[ZombieAISystem] Shutdown" << std::endl;
+    LOG_INFO("ZombieAISystem") << "Shutdown";
 }
 
 void ZombieAISystem::ProcessAI(EntityID entity, engine::ECS::AIComponent& ai, float deltaTime) {
@@ -55,15 +67,14 @@ void ZombieAISystem::ChaseTarget(EntityID zombieEntity, engine::ECS::AIComponent
     MoveTowards(zombieEntity, targetPos, ai.speed);
     
     // Debug output - log movement every 120 frames (~2 seconds at 60fps)
-    static int frameCounter = 0;
-    if (++frameCounter % 120 == 0) {
+    if (++debugFrameCounter_ % 120 == 0) {
         auto* velocity = componentManager.GetComponent<engine::ECS::Velocity2D>(zombieEntity);
-        std::cout << "[ZombieAISystem] Zombie " << zombieEntity 
-                  << " pos(" << zombiePos.x << "," << zombiePos.y << ")"
-                  << " -> target(" << targetPos.x << "," << targetPos.y << ")"
-                  << " distance=" << distance
-                  << " velocity=(" << (velocity ? velocity->vx : 0) << "," << (velocity ? velocity->vy : 0) << ")"
-                  << " speed=" << ai.speed << std::endl;
+        LOG_DEBUG("ZombieAISystem") << "Zombie " << zombieEntity 
+                                   << " pos(" << zombiePos.x << "," << zombiePos.y << ")"
+                                   << " -> target(" << targetPos.x << "," << targetPos.y << ")"
+                                   << " distance=" << distance
+                                   << " velocity=(" << (velocity ? velocity->vx : 0) << "," << (velocity ? velocity->vy : 0) << ")"
+                                   << " speed=" << ai.speed;
     }
 }
 
@@ -82,7 +93,7 @@ void ZombieAISystem::FindNewTarget(EntityID zombieEntity) {
     if (!players.empty()) {
         EntityID nearestPlayer = FindNearestEntity(zombieEntity, players);
         SetTarget(zombieEntity, nearestPlayer, ZombieSurvivor::Component::TargetType::PLAYER);
-        std::cout << "[ZombieAISystem] Zombie " << zombieEntity << " found new target: " << nearestPlayer << std::endl;
+        LOG_DEBUG("ZombieAISystem") << "Zombie " << zombieEntity << " found new target: " << nearestPlayer;
     }
 }
 
@@ -114,8 +125,8 @@ EntityID ZombieAISystem::FindNearestEntity(EntityID fromEntity, const std::vecto
 }
 
 void ZombieAISystem::OnStateChanged(EntityID entity, engine::ECS::AIState oldState, engine::ECS::AIState newState) {
-    std::cout << "[ZombieAISystem] Zombie " << entity << " state changed from " 
-              << static_cast<int>(oldState) << " to " << static_cast<int>(newState) << std::endl;
+    LOG_DEBUG("ZombieAISystem") << "Zombie " << entity << " state changed from " 
+                               << static_cast<int>(oldState) << " to " << static_cast<int>(newState);
 }
 
 void ZombieAISystem::UpdateZombieSpriteState(EntityID zombieEntity, engine::ECS::AIComponent& ai) {
@@ -23,6 +23,7 @@ public:
     void Update(float deltaTime) override;
     void Shutdown() override;
     const char* GetName() const override { return "ZombieAISystem"; }
+    engine::ECS::SystemAccess GetAccess() const override;
 
 protected:
     void ProcessAI(EntityID entity, engine::ECS::AIComponent& ai, float deltaTime) override;
@@ -40,6 +41,8 @@ private:
     
     // Update zombie sprite state based on AI behavior
     void UpdateZombieSpriteState(EntityID zombieEntity, engine::ECS::AIComponent& ai);
+
+    int debugFrameCounter_ = 0;  // Throttles the movement debug log
 };
 
 } // namespace ZombieSurvivor::System
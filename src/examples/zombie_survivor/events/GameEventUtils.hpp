@@ -7,6 +7,7 @@
 #include "GameEventTypes.hpp"
 #include "GameEventData.hpp"
 #include "engine/core/event/EventManager.hpp"
+#include "engine/core/log/Logger.hpp"
 #include <memory>
 
 namespace ZombieSurvivor::Events {
@@ -27,12 +28,12 @@ public:
             std::static_pointer_cast<void>(data)
         );
         gameEvent->SetPriority(engine::event::EventPriority::HIGH);
-        std::cout << "  [DEBUG] Created GameEvent with type: " << static_cast<int>(gameEvent->GetType()) << std::endl;
-        std::cout << "  [DEBUG] Expected CUSTOM type: " << static_cast<int>(engine::event::EventType::CUSTOM) << std::endl;
-        std::cout << "  [DEBUG] GameEventType: " << static_cast<int>(gameEvent->GetGameEventType()) << std::endl;
+        LOG_DEBUG("GameEventUtils") << "Created GameEvent with type: " << static_cast<int>(gameEvent->GetType());
+        LOG_DEBUG("GameEventUtils") << "Expected CUSTOM type: " << static_cast<int>(engine::event::EventType::CUSTOM);
+        LOG_DEBUG("GameEventUtils") << "GameEventType: " << static_cast<int>(gameEvent->GetGameEventType());
         
         eventManager.Publish(gameEvent);
-        std::cout << "  [DEBUG] Event published to EventManager" << std::endl;
+        LOG_DEBUG("GameEventUtils") << "Event published to EventManager";
     }
     
     static void PublishPlayerLevelUp(engine::event::EventManager& eventManager,
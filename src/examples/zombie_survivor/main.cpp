@@ -1,8 +1,10 @@
 #include "engine/Engine.hpp"
 #include "GameScene.hpp"
 #include <iostream>
+#include <cstdlib>
+#include <cstring>
 
-int main() {
+int main(int argc, char* argv[]) {
     std::cout << "=== Game Scene Test - Background Rendering ===" << std::endl;
     
     // 创建引擎
@@ -14,6 +16,18 @@ int main() {
     config.windowWidth = 1312;
     config.windowHeight = 982;
     config.targetFPS = 60;
+    config.textureAtlas = true;  // Horde sheets share one page
+    
+    // --headless [frames]: simulate without a window, uncapped
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--headless") == 0) {
+            config.headless = true;
+            config.targetFPS = 0;
+            if (i + 1 < argc && argv[i + 1][0] != '-') {
+                config.maxFrames = std::strtoull(argv[++i], nullptr, 10);
+            }
+        }
+    }
     
     // 初始化引擎
     if (!gameEngine.Initialize(config)) {
@@ -0,0 +1,131 @@
+// src/sandbox/testbed/benchmark/ComponentStoreBenchmark.cpp
+
+#include "engine/core/ecs/ComponentManager.hpp"
+#include "engine/core/ecs/components/Transform2D.hpp"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+using namespace engine::ECS;
+
+namespace {
+
+// Reference copy of the previous unordered_map-backed store, kept here so the
+// benchmark always measures against the same baseline
+template<typename T>
+class MapComponentStore {
+public:
+    void Add(EntityID id, const T& component) { components_[id] = component; }
+
+    T* Get(EntityID id) {
+        auto it = components_.find(id);
+        return it != components_.end() ? &it->second : nullptr;
+    }
+
+    void ForEach(const std::function<void(EntityID, T&)>& fn) {
+        for (auto& [id, comp] : components_) {
+            fn(id, comp);
+        }
+    }
+
+private:
+    std::unordered_map<EntityID, T> components_;
+};
+
+using Clock = std::chrono::high_resolution_clock;
+
+template<typename Fn>
+double MeasureMs(int repeats, Fn&& fn) {
+    auto start = Clock::now();
+    for (int i = 0; i < repeats; ++i) {
+        fn();
+    }
+    auto end = Clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count() / repeats;
+}
+
+template<typename Store>
+void Populate(Store& store, const std::vector<EntityID>& ids) {
+    for (EntityID id : ids) {
+        store.Add(id, Transform2D{static_cast<float>(id), static_cast<float>(id) * 0.5f, 0.0f, 1.0f, 1.0f});
+    }
+}
+
+template<typename Store>
+float IterateSum(Store& store) {
+    float sum = 0.0f;
+    store.ForEach([&sum](EntityID, Transform2D& t) {
+        t.x += 1.0f;
+        sum += t.x + t.y;
+    });
+    return sum;
+}
+
+template<typename Store>
+float LookupSum(Store& store, const std::vector<EntityID>& lookupOrder) {
+    float sum = 0.0f;
+    for (EntityID id : lookupOrder) {
+        if (auto* t = store.Get(id)) {
+            sum += t->x;
+        }
+    }
+    return sum;
+}
+
+} // namespace
+
+void BenchmarkComponentStore(size_t entityCount) {
+    std::cout << "\n=== ComponentStore Benchmark: " << entityCount << " entities ===" << std::endl;
+
+    std::vector<EntityID> ids(entityCount);
+    for (size_t i = 0; i < entityCount; ++i) {
+        ids[i] = static_cast<EntityID>(i + 1);
+    }
+
+    // Random lookup order models systems probing secondary components
+    std::vector<EntityID> lookupOrder = ids;
+    std::mt19937 rng(1234);
+    std::shuffle(lookupOrder.begin(), lookupOrder.end(), rng);
+
+    MapComponentStore<Transform2D> mapStore;
+    ComponentStore<Transform2D> sparseStore;
+    Populate(mapStore, ids);
+    Populate(sparseStore, ids);
+
+    const int repeats = entityCount >= 100000 ? 20 : 200;
+    volatile float sink = 0.0f;
+
+    double mapIterate = MeasureMs(repeats, [&] { sink = sink + IterateSum(mapStore); });
+    double sparseIterate = MeasureMs(repeats, [&] { sink = sink + IterateSum(sparseStore); });
+    double mapLookup = MeasureMs(repeats, [&] { sink = sink + LookupSum(mapStore, lookupOrder); });
+    double sparseLookup = MeasureMs(repeats, [&] { sink = sink + LookupSum(sparseStore, lookupOrder); });
+
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "ForEach  - unordered_map: " << mapIterate << " ms, sparse set: " << sparseIterate
+              << " ms (x" << std::setprecision(2) << (mapIterate / sparseIterate) << ")" << std::endl;
+    std::cout << std::setprecision(3);
+    std::cout << "Get      - unordered_map: " << mapLookup << " ms, sparse set: " << sparseLookup
+              << " ms (x" << std::setprecision(2) << (mapLookup / sparseLookup) << ")" << std::endl;
+}
+
+void RunComponentStoreBenchmarks() {
+    std::cout << "Starting ComponentStore Benchmarks..." << std::endl;
+
+    BenchmarkComponentStore(1000);
+    BenchmarkComponentStore(10000);
+    BenchmarkComponentStore(100000);
+
+    std::cout << "\n✓ ComponentStore benchmarks completed" << std::endl;
+}
+
+// Main function for standalone benchmarking
+#ifdef COMPONENT_STORE_BENCHMARK_STANDALONE
+int main() {
+    RunComponentStoreBenchmarks();
+    return 0;
+}
+#endif
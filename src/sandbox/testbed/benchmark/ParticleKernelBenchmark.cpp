@@ -0,0 +1,154 @@
+// src/sandbox/testbed/benchmark/ParticleKernelBenchmark.cpp
+
+#include "engine/core/ecs/particles/ParticleKernels.hpp"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace engine::ECS;
+
+namespace {
+
+using Clock = std::chrono::high_resolution_clock;
+
+// One set of particle arrays, filled identically for every kernel
+struct ParticleArrays {
+    std::vector<float> x, y, previousX, previousY, vx, vy, rotation, rotationSpeed;
+    std::vector<float> age, inverseLifetime, startSize, endSize, size, r, g, b, a;
+
+    explicit ParticleArrays(size_t count) {
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+        for (auto* field : {&x, &y, &previousX, &previousY, &vx, &vy, &rotation, &rotationSpeed,
+                            &age, &inverseLifetime, &startSize, &endSize, &size, &r, &g, &b, &a}) {
+            field->resize(count);
+        }
+        for (size_t i = 0; i < count; ++i) {
+            x[i] = unit(rng) * 1000.0f;
+            y[i] = unit(rng) * 1000.0f;
+            vx[i] = unit(rng) * 200.0f - 100.0f;
+            vy[i] = unit(rng) * 200.0f - 100.0f;
+            rotationSpeed[i] = unit(rng) * 4.0f - 2.0f;
+            age[i] = unit(rng) * 0.5f;
+            // Long lives so the particle count stays fixed while timing
+            inverseLifetime[i] = 1.0f / (1000.0f + unit(rng) * 10.0f);
+            startSize[i] = 0.5f + unit(rng);
+            endSize[i] = unit(rng) * 0.1f;
+        }
+    }
+
+    ParticleKernelArgs Args() {
+        ParticleKernelArgs args;
+        args.count = x.size();
+        args.x = x.data();
+        args.y = y.data();
+        args.previousX = previousX.data();
+        args.previousY = previousY.data();
+        args.vx = vx.data();
+        args.vy = vy.data();
+        args.rotation = rotation.data();
+        args.rotationSpeed = rotationSpeed.data();
+        args.age = age.data();
+        args.inverseLifetime = inverseLifetime.data();
+        args.startSize = startSize.data();
+        args.endSize = endSize.data();
+        args.size = size.data();
+        args.r = r.data();
+        args.g = g.data();
+        args.b = b.data();
+        args.a = a.data();
+        args.deltaTime = 1.0f / 60.0f;
+        args.accelerationX = 0.0f;
+        args.accelerationY = 100.0f;
+        return args;
+    }
+};
+
+template<typename Fn>
+double MeasureMs(int repeats, Fn&& fn) {
+    auto start = Clock::now();
+    for (int i = 0; i < repeats; ++i) {
+        fn();
+    }
+    auto end = Clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count() / repeats;
+}
+
+// Largest difference from the scalar result after the same steps
+float MaxDifference(const ParticleArrays& a, const ParticleArrays& b) {
+    float worst = 0.0f;
+    for (size_t i = 0; i < a.x.size(); ++i) {
+        worst = std::max({worst, std::fabs(a.x[i] - b.x[i]), std::fabs(a.y[i] - b.y[i]),
+                          std::fabs(a.size[i] - b.size[i]), std::fabs(a.a[i] - b.a[i])});
+    }
+    return worst;
+}
+
+void BenchmarkParticleKernels(size_t count) {
+    std::cout << "\n=== " << count << " particles ===" << std::endl;
+
+    // Keep total work roughly constant across sizes
+    int repeats = static_cast<int>(std::max<size_t>(5, 20000000 / count));
+
+    const SimdLevel levels[] = {SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2};
+    double scalarMs = 0.0;
+    ParticleArrays reference(count);
+    for (SimdLevel level : levels) {
+        const ParticleKernels& kernels = GetParticleKernels(level);
+        if (kernels.level != level) {
+            std::cout << std::setw(8) << ("(level " + std::to_string(static_cast<int>(level)) + ")")
+                      << " not supported on this CPU" << std::endl;
+            continue;
+        }
+
+        ParticleArrays arrays(count);
+        ParticleKernelArgs args = arrays.Args();
+        volatile size_t sink = 0;
+        // Warm up caches and page in the arrays
+        kernels.integrate(args);
+        sink = sink + kernels.fade(args);
+
+        double ms = MeasureMs(repeats, [&] {
+            kernels.integrate(args);
+            sink = sink + kernels.fade(args);
+        });
+        if (level == SimdLevel::Scalar) {
+            scalarMs = ms;
+            reference = arrays;
+        }
+
+        std::cout << std::fixed << std::setprecision(3);
+        std::cout << std::setw(8) << kernels.name << ": " << ms << " ms/step, "
+                  << std::setprecision(0) << (count / ms) << " particles/ms";
+        if (level != SimdLevel::Scalar && scalarMs > 0.0) {
+            std::cout << std::setprecision(2) << " (x" << (scalarMs / ms) << " vs scalar, max diff "
+                      << std::scientific << MaxDifference(reference, arrays) << std::defaultfloat << ")";
+        }
+        std::cout << std::endl;
+    }
+}
+
+} // namespace
+
+void RunParticleKernelBenchmarks() {
+    std::cout << "Starting particle kernel benchmarks (integrate + fade per step)..." << std::endl;
+    std::cout << "Runtime-selected kernels: " << GetParticleKernels().name << std::endl;
+
+    BenchmarkParticleKernels(10000);
+    BenchmarkParticleKernels(100000);
+    BenchmarkParticleKernels(1000000);
+
+    std::cout << "\n✓ Particle kernel benchmarks completed" << std::endl;
+}
+
+// Main function for standalone benchmarking
+#ifdef PARTICLE_KERNEL_BENCHMARK_STANDALONE
+int main() {
+    RunParticleKernelBenchmarks();
+    return 0;
+}
+#endif
@@ -0,0 +1,117 @@
+// src/sandbox/testbed/benchmark/SpatialGridBenchmark.cpp
+
+#include "engine/core/ecs/EntityHandle.hpp"
+#include "engine/core/ecs/spatial/SimpleGrid.hpp"
+#include "engine/core/ecs/spatial/FlatGrid.hpp"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <vector>
+
+using namespace engine::ECS;
+
+namespace {
+
+using Clock = std::chrono::high_resolution_clock;
+
+constexpr SDL_FRect WORLD_BOUNDS = {0.0f, 0.0f, 4096.0f, 4096.0f};
+constexpr float CELL_SIZE = 64.0f;
+
+template<typename Fn>
+double MeasureMs(int repeats, Fn&& fn) {
+    auto start = Clock::now();
+    for (int i = 0; i < repeats; ++i) {
+        fn();
+    }
+    auto end = Clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count() / repeats;
+}
+
+// Colliders of 16..48 px scattered over the world, a few past its edge
+std::vector<SDL_FRect> MakeBounds(size_t count) {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> position(-64.0f, WORLD_BOUNDS.w + 64.0f);
+    std::uniform_real_distribution<float> size(16.0f, 48.0f);
+    std::vector<SDL_FRect> bounds(count);
+    for (auto& rect : bounds) {
+        rect = {position(rng), position(rng), size(rng), size(rng)};
+    }
+    return bounds;
+}
+
+// Full per-frame rebuild: everything cleared and re-inserted
+void Rebuild(SpatialPartition& partition, const std::vector<EntityID>& ids, const std::vector<SDL_FRect>& bounds) {
+    partition.Clear();
+    for (size_t i = 0; i < ids.size(); ++i) {
+        partition.Insert(ids[i], bounds[i]);
+    }
+}
+
+// Every collider queries its own bounds, as CollisionSystem does
+size_t QueryAll(const SpatialPartition& partition, const std::vector<SDL_FRect>& bounds) {
+    size_t found = 0;
+    for (const auto& rect : bounds) {
+        found += partition.Query(rect).size();
+    }
+    return found;
+}
+
+void BenchmarkSpatialGrids(size_t count) {
+    std::cout << "\n=== " << count << " entities ===" << std::endl;
+
+    std::vector<EntityID> ids(count);
+    for (size_t i = 0; i < count; ++i) {
+        ids[i] = MakeEntityID(static_cast<uint32_t>(i + 1), 0);
+    }
+    std::vector<SDL_FRect> bounds = MakeBounds(count);
+
+    SimpleGrid simpleGrid(CELL_SIZE, WORLD_BOUNDS);
+    FlatGrid flatGrid(CELL_SIZE, WORLD_BOUNDS);
+
+    // Warm up so both have their memory allocated
+    Rebuild(simpleGrid, ids, bounds);
+    Rebuild(flatGrid, ids, bounds);
+    flatGrid.Rebuild();
+
+    const int rebuildRepeats = 20;
+    double simpleRebuild = MeasureMs(rebuildRepeats, [&] { Rebuild(simpleGrid, ids, bounds); });
+    double flatRebuild = MeasureMs(rebuildRepeats, [&] {
+        Rebuild(flatGrid, ids, bounds);
+        flatGrid.Rebuild();
+    });
+
+    const int queryRepeats = 3;
+    size_t simpleFound = 0, flatFound = 0;
+    double simpleQuery = MeasureMs(queryRepeats, [&] { simpleFound = QueryAll(simpleGrid, bounds); });
+    double flatQuery = MeasureMs(queryRepeats, [&] { flatFound = QueryAll(flatGrid, bounds); });
+
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "Rebuild   - SimpleGrid: " << simpleRebuild << " ms, FlatGrid: " << flatRebuild
+              << " ms (x" << std::setprecision(2) << (simpleRebuild / flatRebuild) << ")" << std::endl;
+    std::cout << std::setprecision(3);
+    std::cout << "Query all - SimpleGrid: " << simpleQuery << " ms, FlatGrid: " << flatQuery
+              << " ms (x" << std::setprecision(2) << (simpleQuery / flatQuery) << ")" << std::endl;
+    std::cout << "Results   - SimpleGrid: " << simpleFound << ", FlatGrid: " << flatFound
+              << (simpleFound == flatFound ? " (match)" : " (MISMATCH)") << std::endl;
+}
+
+} // namespace
+
+void RunSpatialGridBenchmarks() {
+    std::cout << "Starting spatial grid benchmarks (cell size " << CELL_SIZE << ")..." << std::endl;
+
+    BenchmarkSpatialGrids(10000);
+    BenchmarkSpatialGrids(50000);
+
+    std::cout << "\n✓ Spatial grid benchmarks completed" << std::endl;
+}
+
+// Main function for standalone benchmarking
+#ifdef SPATIAL_GRID_BENCHMARK_STANDALONE
+int main() {
+    RunSpatialGridBenchmarks();
+    return 0;
+}
+#endif